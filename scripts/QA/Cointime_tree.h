@@ -0,0 +1,491 @@
+//////////////////////////////////////////////////////////
+// Minimal reader generated on 2026-10-19 by scripts/tools/make_reader.py
+// from gen_tree.h
+// for Cointime.C
+// Only the branches used by the macro are enabled and bound.
+// Regenerate instead of editing by hand.
+//////////////////////////////////////////////////////////
+
+#ifndef Cointime_tree_h
+#define Cointime_tree_h
+
+#include <TROOT.h>
+#include <TChain.h>
+#include <TFile.h>
+#include <TLeaf.h>
+#include "../../include/arrayBuffer.C"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+class Cointime_tree {
+public :
+   TTree          *fChain;   //!pointer to the analyzed TTree or TChain
+   Int_t           fCurrent; //!current Tree number in a TChain
+
+   // Declaration of leaf types
+   Int_t           Ndata_bb_etot_over_p;
+   std::vector<Double_t> bb_etot_over_p;   //[Ndata.bb.etot_over_p]
+   Int_t           Ndata_bb_grinch_tdc_hit_clustindex;
+   std::vector<Double_t> bb_grinch_tdc_hit_clustindex;   //[Ndata.bb.grinch_tdc.hit.clustindex]
+   Int_t           Ndata_bb_grinch_tdc_hit_pmtnum;
+   std::vector<Double_t> bb_grinch_tdc_hit_pmtnum;   //[Ndata.bb.grinch_tdc.hit.pmtnum]
+   Int_t           Ndata_bb_grinch_tdc_hit_time_corr;
+   std::vector<Double_t> bb_grinch_tdc_hit_time_corr;   //[Ndata.bb.grinch_tdc.hit.time_corr]
+   Int_t           Ndata_bb_grinch_tdc_hit_trackindex;
+   std::vector<Double_t> bb_grinch_tdc_hit_trackindex;   //[Ndata.bb.grinch_tdc.hit.trackindex]
+   Int_t           Ndata_bb_hodotdc_clus_bar_tdc_tfinal;
+   std::vector<Double_t> bb_hodotdc_clus_bar_tdc_tfinal;   //[Ndata.bb.hodotdc.clus.bar.tdc.tfinal]
+   Int_t           Ndata_bb_hodotdc_clus_id;
+   std::vector<Double_t> bb_hodotdc_clus_id;   //[Ndata.bb.hodotdc.clus.id]
+   Int_t           Ndata_bb_hodotdc_clus_tfinal;
+   std::vector<Double_t> bb_hodotdc_clus_tfinal;   //[Ndata.bb.hodotdc.clus.tfinal]
+   Int_t           Ndata_bb_hodotdc_clus_tmean;
+   std::vector<Double_t> bb_hodotdc_clus_tmean;   //[Ndata.bb.hodotdc.clus.tmean]
+   Int_t           Ndata_bb_hodotdc_clus_tmeanRFcorr;
+   std::vector<Double_t> bb_hodotdc_clus_tmeanRFcorr;   //[Ndata.bb.hodotdc.clus.tmeanRFcorr]
+   Int_t           Ndata_bb_ps_clus_adctime;
+   std::vector<Double_t> bb_ps_clus_adctime;   //[Ndata.bb.ps.clus.adctime]
+   Int_t           Ndata_bb_ps_clus_nblk;
+   std::vector<Double_t> bb_ps_clus_nblk;   //[Ndata.bb.ps.clus.nblk]
+   Int_t           Ndata_bb_ps_clus_blk_atime;
+   std::vector<Double_t> bb_ps_clus_blk_atime;   //[Ndata.bb.ps.clus_blk.atime]
+   Int_t           Ndata_bb_ps_clus_blk_e;
+   std::vector<Double_t> bb_ps_clus_blk_e;   //[Ndata.bb.ps.clus_blk.e]
+   Int_t           Ndata_bb_ps_clus_blk_id;
+   std::vector<Double_t> bb_ps_clus_blk_id;   //[Ndata.bb.ps.clus_blk.id]
+   Int_t           Ndata_bb_sh_clus_adctime;
+   std::vector<Double_t> bb_sh_clus_adctime;   //[Ndata.bb.sh.clus.adctime]
+   Int_t           Ndata_bb_sh_clus_nblk;
+   std::vector<Double_t> bb_sh_clus_nblk;   //[Ndata.bb.sh.clus.nblk]
+   Int_t           Ndata_bb_sh_clus_blk_atime;
+   std::vector<Double_t> bb_sh_clus_blk_atime;   //[Ndata.bb.sh.clus_blk.atime]
+   Int_t           Ndata_bb_sh_clus_blk_e;
+   std::vector<Double_t> bb_sh_clus_blk_e;   //[Ndata.bb.sh.clus_blk.e]
+   Int_t           Ndata_bb_sh_clus_blk_id;
+   std::vector<Double_t> bb_sh_clus_blk_id;   //[Ndata.bb.sh.clus_blk.id]
+   Int_t           Ndata_bb_tr_p;
+   std::vector<Double_t> bb_tr_p;   //[Ndata.bb.tr.p]
+   Int_t           Ndata_bb_tr_ph;
+   std::vector<Double_t> bb_tr_ph;   //[Ndata.bb.tr.ph]
+   Int_t           Ndata_bb_tr_px;
+   std::vector<Double_t> bb_tr_px;   //[Ndata.bb.tr.px]
+   Int_t           Ndata_bb_tr_py;
+   std::vector<Double_t> bb_tr_py;   //[Ndata.bb.tr.py]
+   Int_t           Ndata_bb_tr_pz;
+   std::vector<Double_t> bb_tr_pz;   //[Ndata.bb.tr.pz]
+   Int_t           Ndata_bb_tr_th;
+   std::vector<Double_t> bb_tr_th;   //[Ndata.bb.tr.th]
+   Int_t           Ndata_bb_tr_vx;
+   std::vector<Double_t> bb_tr_vx;   //[Ndata.bb.tr.vx]
+   Int_t           Ndata_bb_tr_vy;
+   std::vector<Double_t> bb_tr_vy;   //[Ndata.bb.tr.vy]
+   Int_t           Ndata_bb_tr_vz;
+   std::vector<Double_t> bb_tr_vz;   //[Ndata.bb.tr.vz]
+   Int_t           Ndata_bb_tr_x;
+   std::vector<Double_t> bb_tr_x;   //[Ndata.bb.tr.x]
+   Int_t           Ndata_bb_tr_y;
+   std::vector<Double_t> bb_tr_y;   //[Ndata.bb.tr.y]
+   Int_t           Ndata_sbs_hcal_clus_adctime;
+   std::vector<Double_t> sbs_hcal_clus_adctime;   //[Ndata.sbs.hcal.clus.adctime]
+   Int_t           Ndata_sbs_hcal_clus_nblk;
+   std::vector<Double_t> sbs_hcal_clus_nblk;   //[Ndata.sbs.hcal.clus.nblk]
+   Int_t           Ndata_sbs_hcal_clus_blk_atime;
+   std::vector<Double_t> sbs_hcal_clus_blk_atime;   //[Ndata.sbs.hcal.clus_blk.atime]
+   Int_t           Ndata_sbs_hcal_clus_blk_e;
+   std::vector<Double_t> sbs_hcal_clus_blk_e;   //[Ndata.sbs.hcal.clus_blk.e]
+   Int_t           Ndata_sbs_hcal_clus_blk_id;
+   std::vector<Double_t> sbs_hcal_clus_blk_id;   //[Ndata.sbs.hcal.clus_blk.id]
+   Double_t        bb_grinch_tdc_bestcluster;
+   Double_t        bb_grinch_tdc_clus_size;
+   Double_t        bb_grinch_tdc_clus_t_mean_corr;
+   Double_t        bb_grinch_tdc_clus_x_mean;
+   Double_t        bb_grinch_tdc_clus_y_mean;
+   Double_t        bb_grinch_tdc_ngoodhits;
+   Double_t        bb_ps_atimeblk;
+   Double_t        bb_ps_colblk;
+   Double_t        bb_ps_e;
+   Double_t        bb_ps_idblk;
+   Double_t        bb_ps_rowblk;
+   Double_t        bb_sh_atimeblk;
+   Double_t        bb_sh_colblk;
+   Double_t        bb_sh_e;
+   Double_t        bb_sh_idblk;
+   Double_t        bb_sh_rowblk;
+   Double_t        bb_tr_n;
+   Double_t        e_kine_W2;
+   Double_t        g_runnum;
+   Double_t        g_trigbits;
+   Double_t        sbs_hcal_atimeblk;
+   Double_t        sbs_hcal_colblk;
+   Double_t        sbs_hcal_e;
+   Double_t        sbs_hcal_idblk;
+   Double_t        sbs_hcal_rowblk;
+   Double_t        sbs_hcal_x;
+   Double_t        sbs_hcal_y;
+
+   // List of branches
+   TBranch        *b_Ndata_bb_etot_over_p;   //!
+   TBranch        *b_bb_etot_over_p;   //!
+   TBranch        *b_Ndata_bb_grinch_tdc_hit_clustindex;   //!
+   TBranch        *b_bb_grinch_tdc_hit_clustindex;   //!
+   TBranch        *b_Ndata_bb_grinch_tdc_hit_pmtnum;   //!
+   TBranch        *b_bb_grinch_tdc_hit_pmtnum;   //!
+   TBranch        *b_Ndata_bb_grinch_tdc_hit_time_corr;   //!
+   TBranch        *b_bb_grinch_tdc_hit_time_corr;   //!
+   TBranch        *b_Ndata_bb_grinch_tdc_hit_trackindex;   //!
+   TBranch        *b_bb_grinch_tdc_hit_trackindex;   //!
+   TBranch        *b_Ndata_bb_hodotdc_clus_bar_tdc_tfinal;   //!
+   TBranch        *b_bb_hodotdc_clus_bar_tdc_tfinal;   //!
+   TBranch        *b_Ndata_bb_hodotdc_clus_id;   //!
+   TBranch        *b_bb_hodotdc_clus_id;   //!
+   TBranch        *b_Ndata_bb_hodotdc_clus_tfinal;   //!
+   TBranch        *b_bb_hodotdc_clus_tfinal;   //!
+   TBranch        *b_Ndata_bb_hodotdc_clus_tmean;   //!
+   TBranch        *b_bb_hodotdc_clus_tmean;   //!
+   TBranch        *b_Ndata_bb_hodotdc_clus_tmeanRFcorr;   //!
+   TBranch        *b_bb_hodotdc_clus_tmeanRFcorr;   //!
+   TBranch        *b_Ndata_bb_ps_clus_adctime;   //!
+   TBranch        *b_bb_ps_clus_adctime;   //!
+   TBranch        *b_Ndata_bb_ps_clus_nblk;   //!
+   TBranch        *b_bb_ps_clus_nblk;   //!
+   TBranch        *b_Ndata_bb_ps_clus_blk_atime;   //!
+   TBranch        *b_bb_ps_clus_blk_atime;   //!
+   TBranch        *b_Ndata_bb_ps_clus_blk_e;   //!
+   TBranch        *b_bb_ps_clus_blk_e;   //!
+   TBranch        *b_Ndata_bb_ps_clus_blk_id;   //!
+   TBranch        *b_bb_ps_clus_blk_id;   //!
+   TBranch        *b_Ndata_bb_sh_clus_adctime;   //!
+   TBranch        *b_bb_sh_clus_adctime;   //!
+   TBranch        *b_Ndata_bb_sh_clus_nblk;   //!
+   TBranch        *b_bb_sh_clus_nblk;   //!
+   TBranch        *b_Ndata_bb_sh_clus_blk_atime;   //!
+   TBranch        *b_bb_sh_clus_blk_atime;   //!
+   TBranch        *b_Ndata_bb_sh_clus_blk_e;   //!
+   TBranch        *b_bb_sh_clus_blk_e;   //!
+   TBranch        *b_Ndata_bb_sh_clus_blk_id;   //!
+   TBranch        *b_bb_sh_clus_blk_id;   //!
+   TBranch        *b_Ndata_bb_tr_p;   //!
+   TBranch        *b_bb_tr_p;   //!
+   TBranch        *b_Ndata_bb_tr_ph;   //!
+   TBranch        *b_bb_tr_ph;   //!
+   TBranch        *b_Ndata_bb_tr_px;   //!
+   TBranch        *b_bb_tr_px;   //!
+   TBranch        *b_Ndata_bb_tr_py;   //!
+   TBranch        *b_bb_tr_py;   //!
+   TBranch        *b_Ndata_bb_tr_pz;   //!
+   TBranch        *b_bb_tr_pz;   //!
+   TBranch        *b_Ndata_bb_tr_th;   //!
+   TBranch        *b_bb_tr_th;   //!
+   TBranch        *b_Ndata_bb_tr_vx;   //!
+   TBranch        *b_bb_tr_vx;   //!
+   TBranch        *b_Ndata_bb_tr_vy;   //!
+   TBranch        *b_bb_tr_vy;   //!
+   TBranch        *b_Ndata_bb_tr_vz;   //!
+   TBranch        *b_bb_tr_vz;   //!
+   TBranch        *b_Ndata_bb_tr_x;   //!
+   TBranch        *b_bb_tr_x;   //!
+   TBranch        *b_Ndata_bb_tr_y;   //!
+   TBranch        *b_bb_tr_y;   //!
+   TBranch        *b_Ndata_sbs_hcal_clus_adctime;   //!
+   TBranch        *b_sbs_hcal_clus_adctime;   //!
+   TBranch        *b_Ndata_sbs_hcal_clus_nblk;   //!
+   TBranch        *b_sbs_hcal_clus_nblk;   //!
+   TBranch        *b_Ndata_sbs_hcal_clus_blk_atime;   //!
+   TBranch        *b_sbs_hcal_clus_blk_atime;   //!
+   TBranch        *b_Ndata_sbs_hcal_clus_blk_e;   //!
+   TBranch        *b_sbs_hcal_clus_blk_e;   //!
+   TBranch        *b_Ndata_sbs_hcal_clus_blk_id;   //!
+   TBranch        *b_sbs_hcal_clus_blk_id;   //!
+   TBranch        *b_bb_grinch_tdc_bestcluster;   //!
+   TBranch        *b_bb_grinch_tdc_clus_size;   //!
+   TBranch        *b_bb_grinch_tdc_clus_t_mean_corr;   //!
+   TBranch        *b_bb_grinch_tdc_clus_x_mean;   //!
+   TBranch        *b_bb_grinch_tdc_clus_y_mean;   //!
+   TBranch        *b_bb_grinch_tdc_ngoodhits;   //!
+   TBranch        *b_bb_ps_atimeblk;   //!
+   TBranch        *b_bb_ps_colblk;   //!
+   TBranch        *b_bb_ps_e;   //!
+   TBranch        *b_bb_ps_idblk;   //!
+   TBranch        *b_bb_ps_rowblk;   //!
+   TBranch        *b_bb_sh_atimeblk;   //!
+   TBranch        *b_bb_sh_colblk;   //!
+   TBranch        *b_bb_sh_e;   //!
+   TBranch        *b_bb_sh_idblk;   //!
+   TBranch        *b_bb_sh_rowblk;   //!
+   TBranch        *b_bb_tr_n;   //!
+   TBranch        *b_e_kine_W2;   //!
+   TBranch        *b_g_runnum;   //!
+   TBranch        *b_g_trigbits;   //!
+   TBranch        *b_sbs_hcal_atimeblk;   //!
+   TBranch        *b_sbs_hcal_colblk;   //!
+   TBranch        *b_sbs_hcal_e;   //!
+   TBranch        *b_sbs_hcal_idblk;   //!
+   TBranch        *b_sbs_hcal_rowblk;   //!
+   TBranch        *b_sbs_hcal_x;   //!
+   TBranch        *b_sbs_hcal_y;   //!
+
+   Cointime_tree(TTree *tree) : fChain(0) { Init(tree); }
+   virtual ~Cointime_tree() { }
+   virtual Int_t    GetEntry(Long64_t entry);
+   virtual Long64_t LoadTree(Long64_t entry);
+   virtual void     Init(TTree *tree);
+   virtual Bool_t   Notify();
+   template <typename T>
+   void             BindArray(TTree *tree, const char *name, std::vector<T> &buf, TBranch **br);
+};
+
+inline Int_t Cointime_tree::GetEntry(Long64_t entry)
+{
+   if (!fChain) return 0;
+   if (LoadTree(entry) < 0) return 0;
+   return fChain->GetEntry(entry);
+}
+
+inline Long64_t Cointime_tree::LoadTree(Long64_t entry)
+{
+   if (!fChain) return -5;
+   Long64_t centry = fChain->LoadTree(entry);
+   if (centry < 0) return centry;
+   if (fChain->GetTreeNumber() != fCurrent) {
+      fCurrent = fChain->GetTreeNumber();
+      Notify();
+   }
+   return centry;
+}
+
+inline void Cointime_tree::Init(TTree *tree)
+{
+   if (!tree) return;
+   fChain = tree;
+   fCurrent = -1;
+   fChain->SetMakeClass(1);
+
+   fChain->SetBranchStatus("*", 0);
+   fChain->SetBranchStatus("Ndata.bb.etot_over_p", 1);
+   fChain->SetBranchStatus("bb.etot_over_p", 1);
+   fChain->SetBranchStatus("Ndata.bb.grinch_tdc.hit.clustindex", 1);
+   fChain->SetBranchStatus("bb.grinch_tdc.hit.clustindex", 1);
+   fChain->SetBranchStatus("Ndata.bb.grinch_tdc.hit.pmtnum", 1);
+   fChain->SetBranchStatus("bb.grinch_tdc.hit.pmtnum", 1);
+   fChain->SetBranchStatus("Ndata.bb.grinch_tdc.hit.time_corr", 1);
+   fChain->SetBranchStatus("bb.grinch_tdc.hit.time_corr", 1);
+   fChain->SetBranchStatus("Ndata.bb.grinch_tdc.hit.trackindex", 1);
+   fChain->SetBranchStatus("bb.grinch_tdc.hit.trackindex", 1);
+   fChain->SetBranchStatus("Ndata.bb.hodotdc.clus.bar.tdc.tfinal", 1);
+   fChain->SetBranchStatus("bb.hodotdc.clus.bar.tdc.tfinal", 1);
+   fChain->SetBranchStatus("Ndata.bb.hodotdc.clus.id", 1);
+   fChain->SetBranchStatus("bb.hodotdc.clus.id", 1);
+   fChain->SetBranchStatus("Ndata.bb.hodotdc.clus.tfinal", 1);
+   fChain->SetBranchStatus("bb.hodotdc.clus.tfinal", 1);
+   fChain->SetBranchStatus("Ndata.bb.hodotdc.clus.tmean", 1);
+   fChain->SetBranchStatus("bb.hodotdc.clus.tmean", 1);
+   fChain->SetBranchStatus("Ndata.bb.hodotdc.clus.tmeanRFcorr", 1);
+   fChain->SetBranchStatus("bb.hodotdc.clus.tmeanRFcorr", 1);
+   fChain->SetBranchStatus("Ndata.bb.ps.clus.adctime", 1);
+   fChain->SetBranchStatus("bb.ps.clus.adctime", 1);
+   fChain->SetBranchStatus("Ndata.bb.ps.clus.nblk", 1);
+   fChain->SetBranchStatus("bb.ps.clus.nblk", 1);
+   fChain->SetBranchStatus("Ndata.bb.ps.clus_blk.atime", 1);
+   fChain->SetBranchStatus("bb.ps.clus_blk.atime", 1);
+   fChain->SetBranchStatus("Ndata.bb.ps.clus_blk.e", 1);
+   fChain->SetBranchStatus("bb.ps.clus_blk.e", 1);
+   fChain->SetBranchStatus("Ndata.bb.ps.clus_blk.id", 1);
+   fChain->SetBranchStatus("bb.ps.clus_blk.id", 1);
+   fChain->SetBranchStatus("Ndata.bb.sh.clus.adctime", 1);
+   fChain->SetBranchStatus("bb.sh.clus.adctime", 1);
+   fChain->SetBranchStatus("Ndata.bb.sh.clus.nblk", 1);
+   fChain->SetBranchStatus("bb.sh.clus.nblk", 1);
+   fChain->SetBranchStatus("Ndata.bb.sh.clus_blk.atime", 1);
+   fChain->SetBranchStatus("bb.sh.clus_blk.atime", 1);
+   fChain->SetBranchStatus("Ndata.bb.sh.clus_blk.e", 1);
+   fChain->SetBranchStatus("bb.sh.clus_blk.e", 1);
+   fChain->SetBranchStatus("Ndata.bb.sh.clus_blk.id", 1);
+   fChain->SetBranchStatus("bb.sh.clus_blk.id", 1);
+   fChain->SetBranchStatus("Ndata.bb.tr.p", 1);
+   fChain->SetBranchStatus("bb.tr.p", 1);
+   fChain->SetBranchStatus("Ndata.bb.tr.ph", 1);
+   fChain->SetBranchStatus("bb.tr.ph", 1);
+   fChain->SetBranchStatus("Ndata.bb.tr.px", 1);
+   fChain->SetBranchStatus("bb.tr.px", 1);
+   fChain->SetBranchStatus("Ndata.bb.tr.py", 1);
+   fChain->SetBranchStatus("bb.tr.py", 1);
+   fChain->SetBranchStatus("Ndata.bb.tr.pz", 1);
+   fChain->SetBranchStatus("bb.tr.pz", 1);
+   fChain->SetBranchStatus("Ndata.bb.tr.th", 1);
+   fChain->SetBranchStatus("bb.tr.th", 1);
+   fChain->SetBranchStatus("Ndata.bb.tr.vx", 1);
+   fChain->SetBranchStatus("bb.tr.vx", 1);
+   fChain->SetBranchStatus("Ndata.bb.tr.vy", 1);
+   fChain->SetBranchStatus("bb.tr.vy", 1);
+   fChain->SetBranchStatus("Ndata.bb.tr.vz", 1);
+   fChain->SetBranchStatus("bb.tr.vz", 1);
+   fChain->SetBranchStatus("Ndata.bb.tr.x", 1);
+   fChain->SetBranchStatus("bb.tr.x", 1);
+   fChain->SetBranchStatus("Ndata.bb.tr.y", 1);
+   fChain->SetBranchStatus("bb.tr.y", 1);
+   fChain->SetBranchStatus("Ndata.sbs.hcal.clus.adctime", 1);
+   fChain->SetBranchStatus("sbs.hcal.clus.adctime", 1);
+   fChain->SetBranchStatus("Ndata.sbs.hcal.clus.nblk", 1);
+   fChain->SetBranchStatus("sbs.hcal.clus.nblk", 1);
+   fChain->SetBranchStatus("Ndata.sbs.hcal.clus_blk.atime", 1);
+   fChain->SetBranchStatus("sbs.hcal.clus_blk.atime", 1);
+   fChain->SetBranchStatus("Ndata.sbs.hcal.clus_blk.e", 1);
+   fChain->SetBranchStatus("sbs.hcal.clus_blk.e", 1);
+   fChain->SetBranchStatus("Ndata.sbs.hcal.clus_blk.id", 1);
+   fChain->SetBranchStatus("sbs.hcal.clus_blk.id", 1);
+   fChain->SetBranchStatus("bb.grinch_tdc.bestcluster", 1);
+   fChain->SetBranchStatus("bb.grinch_tdc.clus.size", 1);
+   fChain->SetBranchStatus("bb.grinch_tdc.clus.t_mean_corr", 1);
+   fChain->SetBranchStatus("bb.grinch_tdc.clus.x_mean", 1);
+   fChain->SetBranchStatus("bb.grinch_tdc.clus.y_mean", 1);
+   fChain->SetBranchStatus("bb.grinch_tdc.ngoodhits", 1);
+   fChain->SetBranchStatus("bb.ps.atimeblk", 1);
+   fChain->SetBranchStatus("bb.ps.colblk", 1);
+   fChain->SetBranchStatus("bb.ps.e", 1);
+   fChain->SetBranchStatus("bb.ps.idblk", 1);
+   fChain->SetBranchStatus("bb.ps.rowblk", 1);
+   fChain->SetBranchStatus("bb.sh.atimeblk", 1);
+   fChain->SetBranchStatus("bb.sh.colblk", 1);
+   fChain->SetBranchStatus("bb.sh.e", 1);
+   fChain->SetBranchStatus("bb.sh.idblk", 1);
+   fChain->SetBranchStatus("bb.sh.rowblk", 1);
+   fChain->SetBranchStatus("bb.tr.n", 1);
+   fChain->SetBranchStatus("e.kine.W2", 1);
+   fChain->SetBranchStatus("g.runnum", 1);
+   fChain->SetBranchStatus("g.trigbits", 1);
+   fChain->SetBranchStatus("sbs.hcal.atimeblk", 1);
+   fChain->SetBranchStatus("sbs.hcal.colblk", 1);
+   fChain->SetBranchStatus("sbs.hcal.e", 1);
+   fChain->SetBranchStatus("sbs.hcal.idblk", 1);
+   fChain->SetBranchStatus("sbs.hcal.rowblk", 1);
+   fChain->SetBranchStatus("sbs.hcal.x", 1);
+   fChain->SetBranchStatus("sbs.hcal.y", 1);
+
+   // array buffers are bound per tree in Notify()
+   fChain->SetBranchAddress("Ndata.bb.etot_over_p", &Ndata_bb_etot_over_p, &b_Ndata_bb_etot_over_p);
+   fChain->SetBranchAddress("Ndata.bb.grinch_tdc.hit.clustindex", &Ndata_bb_grinch_tdc_hit_clustindex, &b_Ndata_bb_grinch_tdc_hit_clustindex);
+   fChain->SetBranchAddress("Ndata.bb.grinch_tdc.hit.pmtnum", &Ndata_bb_grinch_tdc_hit_pmtnum, &b_Ndata_bb_grinch_tdc_hit_pmtnum);
+   fChain->SetBranchAddress("Ndata.bb.grinch_tdc.hit.time_corr", &Ndata_bb_grinch_tdc_hit_time_corr, &b_Ndata_bb_grinch_tdc_hit_time_corr);
+   fChain->SetBranchAddress("Ndata.bb.grinch_tdc.hit.trackindex", &Ndata_bb_grinch_tdc_hit_trackindex, &b_Ndata_bb_grinch_tdc_hit_trackindex);
+   fChain->SetBranchAddress("Ndata.bb.hodotdc.clus.bar.tdc.tfinal", &Ndata_bb_hodotdc_clus_bar_tdc_tfinal, &b_Ndata_bb_hodotdc_clus_bar_tdc_tfinal);
+   fChain->SetBranchAddress("Ndata.bb.hodotdc.clus.id", &Ndata_bb_hodotdc_clus_id, &b_Ndata_bb_hodotdc_clus_id);
+   fChain->SetBranchAddress("Ndata.bb.hodotdc.clus.tfinal", &Ndata_bb_hodotdc_clus_tfinal, &b_Ndata_bb_hodotdc_clus_tfinal);
+   fChain->SetBranchAddress("Ndata.bb.hodotdc.clus.tmean", &Ndata_bb_hodotdc_clus_tmean, &b_Ndata_bb_hodotdc_clus_tmean);
+   fChain->SetBranchAddress("Ndata.bb.hodotdc.clus.tmeanRFcorr", &Ndata_bb_hodotdc_clus_tmeanRFcorr, &b_Ndata_bb_hodotdc_clus_tmeanRFcorr);
+   fChain->SetBranchAddress("Ndata.bb.ps.clus.adctime", &Ndata_bb_ps_clus_adctime, &b_Ndata_bb_ps_clus_adctime);
+   fChain->SetBranchAddress("Ndata.bb.ps.clus.nblk", &Ndata_bb_ps_clus_nblk, &b_Ndata_bb_ps_clus_nblk);
+   fChain->SetBranchAddress("Ndata.bb.ps.clus_blk.atime", &Ndata_bb_ps_clus_blk_atime, &b_Ndata_bb_ps_clus_blk_atime);
+   fChain->SetBranchAddress("Ndata.bb.ps.clus_blk.e", &Ndata_bb_ps_clus_blk_e, &b_Ndata_bb_ps_clus_blk_e);
+   fChain->SetBranchAddress("Ndata.bb.ps.clus_blk.id", &Ndata_bb_ps_clus_blk_id, &b_Ndata_bb_ps_clus_blk_id);
+   fChain->SetBranchAddress("Ndata.bb.sh.clus.adctime", &Ndata_bb_sh_clus_adctime, &b_Ndata_bb_sh_clus_adctime);
+   fChain->SetBranchAddress("Ndata.bb.sh.clus.nblk", &Ndata_bb_sh_clus_nblk, &b_Ndata_bb_sh_clus_nblk);
+   fChain->SetBranchAddress("Ndata.bb.sh.clus_blk.atime", &Ndata_bb_sh_clus_blk_atime, &b_Ndata_bb_sh_clus_blk_atime);
+   fChain->SetBranchAddress("Ndata.bb.sh.clus_blk.e", &Ndata_bb_sh_clus_blk_e, &b_Ndata_bb_sh_clus_blk_e);
+   fChain->SetBranchAddress("Ndata.bb.sh.clus_blk.id", &Ndata_bb_sh_clus_blk_id, &b_Ndata_bb_sh_clus_blk_id);
+   fChain->SetBranchAddress("Ndata.bb.tr.p", &Ndata_bb_tr_p, &b_Ndata_bb_tr_p);
+   fChain->SetBranchAddress("Ndata.bb.tr.ph", &Ndata_bb_tr_ph, &b_Ndata_bb_tr_ph);
+   fChain->SetBranchAddress("Ndata.bb.tr.px", &Ndata_bb_tr_px, &b_Ndata_bb_tr_px);
+   fChain->SetBranchAddress("Ndata.bb.tr.py", &Ndata_bb_tr_py, &b_Ndata_bb_tr_py);
+   fChain->SetBranchAddress("Ndata.bb.tr.pz", &Ndata_bb_tr_pz, &b_Ndata_bb_tr_pz);
+   fChain->SetBranchAddress("Ndata.bb.tr.th", &Ndata_bb_tr_th, &b_Ndata_bb_tr_th);
+   fChain->SetBranchAddress("Ndata.bb.tr.vx", &Ndata_bb_tr_vx, &b_Ndata_bb_tr_vx);
+   fChain->SetBranchAddress("Ndata.bb.tr.vy", &Ndata_bb_tr_vy, &b_Ndata_bb_tr_vy);
+   fChain->SetBranchAddress("Ndata.bb.tr.vz", &Ndata_bb_tr_vz, &b_Ndata_bb_tr_vz);
+   fChain->SetBranchAddress("Ndata.bb.tr.x", &Ndata_bb_tr_x, &b_Ndata_bb_tr_x);
+   fChain->SetBranchAddress("Ndata.bb.tr.y", &Ndata_bb_tr_y, &b_Ndata_bb_tr_y);
+   fChain->SetBranchAddress("Ndata.sbs.hcal.clus.adctime", &Ndata_sbs_hcal_clus_adctime, &b_Ndata_sbs_hcal_clus_adctime);
+   fChain->SetBranchAddress("Ndata.sbs.hcal.clus.nblk", &Ndata_sbs_hcal_clus_nblk, &b_Ndata_sbs_hcal_clus_nblk);
+   fChain->SetBranchAddress("Ndata.sbs.hcal.clus_blk.atime", &Ndata_sbs_hcal_clus_blk_atime, &b_Ndata_sbs_hcal_clus_blk_atime);
+   fChain->SetBranchAddress("Ndata.sbs.hcal.clus_blk.e", &Ndata_sbs_hcal_clus_blk_e, &b_Ndata_sbs_hcal_clus_blk_e);
+   fChain->SetBranchAddress("Ndata.sbs.hcal.clus_blk.id", &Ndata_sbs_hcal_clus_blk_id, &b_Ndata_sbs_hcal_clus_blk_id);
+   fChain->SetBranchAddress("bb.grinch_tdc.bestcluster", &bb_grinch_tdc_bestcluster, &b_bb_grinch_tdc_bestcluster);
+   fChain->SetBranchAddress("bb.grinch_tdc.clus.size", &bb_grinch_tdc_clus_size, &b_bb_grinch_tdc_clus_size);
+   fChain->SetBranchAddress("bb.grinch_tdc.clus.t_mean_corr", &bb_grinch_tdc_clus_t_mean_corr, &b_bb_grinch_tdc_clus_t_mean_corr);
+   fChain->SetBranchAddress("bb.grinch_tdc.clus.x_mean", &bb_grinch_tdc_clus_x_mean, &b_bb_grinch_tdc_clus_x_mean);
+   fChain->SetBranchAddress("bb.grinch_tdc.clus.y_mean", &bb_grinch_tdc_clus_y_mean, &b_bb_grinch_tdc_clus_y_mean);
+   fChain->SetBranchAddress("bb.grinch_tdc.ngoodhits", &bb_grinch_tdc_ngoodhits, &b_bb_grinch_tdc_ngoodhits);
+   fChain->SetBranchAddress("bb.ps.atimeblk", &bb_ps_atimeblk, &b_bb_ps_atimeblk);
+   fChain->SetBranchAddress("bb.ps.colblk", &bb_ps_colblk, &b_bb_ps_colblk);
+   fChain->SetBranchAddress("bb.ps.e", &bb_ps_e, &b_bb_ps_e);
+   fChain->SetBranchAddress("bb.ps.idblk", &bb_ps_idblk, &b_bb_ps_idblk);
+   fChain->SetBranchAddress("bb.ps.rowblk", &bb_ps_rowblk, &b_bb_ps_rowblk);
+   fChain->SetBranchAddress("bb.sh.atimeblk", &bb_sh_atimeblk, &b_bb_sh_atimeblk);
+   fChain->SetBranchAddress("bb.sh.colblk", &bb_sh_colblk, &b_bb_sh_colblk);
+   fChain->SetBranchAddress("bb.sh.e", &bb_sh_e, &b_bb_sh_e);
+   fChain->SetBranchAddress("bb.sh.idblk", &bb_sh_idblk, &b_bb_sh_idblk);
+   fChain->SetBranchAddress("bb.sh.rowblk", &bb_sh_rowblk, &b_bb_sh_rowblk);
+   fChain->SetBranchAddress("bb.tr.n", &bb_tr_n, &b_bb_tr_n);
+   fChain->SetBranchAddress("e.kine.W2", &e_kine_W2, &b_e_kine_W2);
+   fChain->SetBranchAddress("g.runnum", &g_runnum, &b_g_runnum);
+   fChain->SetBranchAddress("g.trigbits", &g_trigbits, &b_g_trigbits);
+   fChain->SetBranchAddress("sbs.hcal.atimeblk", &sbs_hcal_atimeblk, &b_sbs_hcal_atimeblk);
+   fChain->SetBranchAddress("sbs.hcal.colblk", &sbs_hcal_colblk, &b_sbs_hcal_colblk);
+   fChain->SetBranchAddress("sbs.hcal.e", &sbs_hcal_e, &b_sbs_hcal_e);
+   fChain->SetBranchAddress("sbs.hcal.idblk", &sbs_hcal_idblk, &b_sbs_hcal_idblk);
+   fChain->SetBranchAddress("sbs.hcal.rowblk", &sbs_hcal_rowblk, &b_sbs_hcal_rowblk);
+   fChain->SetBranchAddress("sbs.hcal.x", &sbs_hcal_x, &b_sbs_hcal_x);
+   fChain->SetBranchAddress("sbs.hcal.y", &sbs_hcal_y, &b_sbs_hcal_y);
+}
+
+inline Bool_t Cointime_tree::Notify()
+{
+   // Array buffers follow the per-tree Ndata maximum, see BindArray
+   if (!fChain || !fChain->GetTree()) return kTRUE;
+   TTree *tree = fChain->GetTree();
+   BindArray(tree, "bb.etot_over_p", bb_etot_over_p, &b_bb_etot_over_p);
+   BindArray(tree, "bb.grinch_tdc.hit.clustindex", bb_grinch_tdc_hit_clustindex, &b_bb_grinch_tdc_hit_clustindex);
+   BindArray(tree, "bb.grinch_tdc.hit.pmtnum", bb_grinch_tdc_hit_pmtnum, &b_bb_grinch_tdc_hit_pmtnum);
+   BindArray(tree, "bb.grinch_tdc.hit.time_corr", bb_grinch_tdc_hit_time_corr, &b_bb_grinch_tdc_hit_time_corr);
+   BindArray(tree, "bb.grinch_tdc.hit.trackindex", bb_grinch_tdc_hit_trackindex, &b_bb_grinch_tdc_hit_trackindex);
+   BindArray(tree, "bb.hodotdc.clus.bar.tdc.tfinal", bb_hodotdc_clus_bar_tdc_tfinal, &b_bb_hodotdc_clus_bar_tdc_tfinal);
+   BindArray(tree, "bb.hodotdc.clus.id", bb_hodotdc_clus_id, &b_bb_hodotdc_clus_id);
+   BindArray(tree, "bb.hodotdc.clus.tfinal", bb_hodotdc_clus_tfinal, &b_bb_hodotdc_clus_tfinal);
+   BindArray(tree, "bb.hodotdc.clus.tmean", bb_hodotdc_clus_tmean, &b_bb_hodotdc_clus_tmean);
+   BindArray(tree, "bb.hodotdc.clus.tmeanRFcorr", bb_hodotdc_clus_tmeanRFcorr, &b_bb_hodotdc_clus_tmeanRFcorr);
+   BindArray(tree, "bb.ps.clus.adctime", bb_ps_clus_adctime, &b_bb_ps_clus_adctime);
+   BindArray(tree, "bb.ps.clus.nblk", bb_ps_clus_nblk, &b_bb_ps_clus_nblk);
+   BindArray(tree, "bb.ps.clus_blk.atime", bb_ps_clus_blk_atime, &b_bb_ps_clus_blk_atime);
+   BindArray(tree, "bb.ps.clus_blk.e", bb_ps_clus_blk_e, &b_bb_ps_clus_blk_e);
+   BindArray(tree, "bb.ps.clus_blk.id", bb_ps_clus_blk_id, &b_bb_ps_clus_blk_id);
+   BindArray(tree, "bb.sh.clus.adctime", bb_sh_clus_adctime, &b_bb_sh_clus_adctime);
+   BindArray(tree, "bb.sh.clus.nblk", bb_sh_clus_nblk, &b_bb_sh_clus_nblk);
+   BindArray(tree, "bb.sh.clus_blk.atime", bb_sh_clus_blk_atime, &b_bb_sh_clus_blk_atime);
+   BindArray(tree, "bb.sh.clus_blk.e", bb_sh_clus_blk_e, &b_bb_sh_clus_blk_e);
+   BindArray(tree, "bb.sh.clus_blk.id", bb_sh_clus_blk_id, &b_bb_sh_clus_blk_id);
+   BindArray(tree, "bb.tr.p", bb_tr_p, &b_bb_tr_p);
+   BindArray(tree, "bb.tr.ph", bb_tr_ph, &b_bb_tr_ph);
+   BindArray(tree, "bb.tr.px", bb_tr_px, &b_bb_tr_px);
+   BindArray(tree, "bb.tr.py", bb_tr_py, &b_bb_tr_py);
+   BindArray(tree, "bb.tr.pz", bb_tr_pz, &b_bb_tr_pz);
+   BindArray(tree, "bb.tr.th", bb_tr_th, &b_bb_tr_th);
+   BindArray(tree, "bb.tr.vx", bb_tr_vx, &b_bb_tr_vx);
+   BindArray(tree, "bb.tr.vy", bb_tr_vy, &b_bb_tr_vy);
+   BindArray(tree, "bb.tr.vz", bb_tr_vz, &b_bb_tr_vz);
+   BindArray(tree, "bb.tr.x", bb_tr_x, &b_bb_tr_x);
+   BindArray(tree, "bb.tr.y", bb_tr_y, &b_bb_tr_y);
+   BindArray(tree, "sbs.hcal.clus.adctime", sbs_hcal_clus_adctime, &b_sbs_hcal_clus_adctime);
+   BindArray(tree, "sbs.hcal.clus.nblk", sbs_hcal_clus_nblk, &b_sbs_hcal_clus_nblk);
+   BindArray(tree, "sbs.hcal.clus_blk.atime", sbs_hcal_clus_blk_atime, &b_sbs_hcal_clus_blk_atime);
+   BindArray(tree, "sbs.hcal.clus_blk.e", sbs_hcal_clus_blk_e, &b_sbs_hcal_clus_blk_e);
+   BindArray(tree, "sbs.hcal.clus_blk.id", sbs_hcal_clus_blk_id, &b_sbs_hcal_clus_blk_id);
+   return kTRUE;
+}
+
+template <typename T>
+inline void Cointime_tree::BindArray(TTree *tree, const char *name, std::vector<T> &buf, TBranch **br)
+{
+   // ROOT clamps reads to the per-tree Ndata maximum, so a buffer of
+   // LeafCapacity elements holds every entry; grown and rebound as needed
+   TBranch *branch = tree->GetBranch(name);
+   TLeaf *leaf = branch ? (TLeaf*)branch->GetListOfLeaves()->At(0) : 0;
+   if (!leaf) std::cerr << "Error >> Branch " << name << " not found in tree" << std::endl;
+   int capacity = std::max(LeafCapacity(leaf), 1);
+   if (capacity > (int)buf.size()) {
+      buf.resize(capacity);
+      fChain->SetBranchAddress(name, buf.data(), br);
+   }
+}
+
+#endif // #ifndef Cointime_tree_h
@@ -0,0 +1,245 @@
+//////////////////////////////////////////////////////////
+// Minimal reader generated on 2026-10-19 by scripts/tools/make_reader.py
+// from gen_tree.h
+// for SBShcal.C
+// Only the branches used by the macro are enabled and bound.
+// Regenerate instead of editing by hand.
+//////////////////////////////////////////////////////////
+
+#ifndef SBShcal_tree_h
+#define SBShcal_tree_h
+
+#include <TROOT.h>
+#include <TChain.h>
+#include <TFile.h>
+#include <TLeaf.h>
+#include "../../include/arrayBuffer.C"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+class SBShcal_tree {
+public :
+   TTree          *fChain;   //!pointer to the analyzed TTree or TChain
+   Int_t           fCurrent; //!current Tree number in a TChain
+
+   // Declaration of leaf types
+   Int_t           Ndata_bb_hodotdc_clus_tfinal;
+   std::vector<Double_t> bb_hodotdc_clus_tfinal;   //[Ndata.bb.hodotdc.clus.tfinal]
+   Int_t           Ndata_bb_sh_clus_adctime;
+   std::vector<Double_t> bb_sh_clus_adctime;   //[Ndata.bb.sh.clus.adctime]
+   Int_t           Ndata_bb_tr_p;
+   std::vector<Double_t> bb_tr_p;   //[Ndata.bb.tr.p]
+   Int_t           Ndata_bb_tr_px;
+   std::vector<Double_t> bb_tr_px;   //[Ndata.bb.tr.px]
+   Int_t           Ndata_bb_tr_py;
+   std::vector<Double_t> bb_tr_py;   //[Ndata.bb.tr.py]
+   Int_t           Ndata_bb_tr_pz;
+   std::vector<Double_t> bb_tr_pz;   //[Ndata.bb.tr.pz]
+   Int_t           Ndata_bb_tr_vx;
+   std::vector<Double_t> bb_tr_vx;   //[Ndata.bb.tr.vx]
+   Int_t           Ndata_bb_tr_vy;
+   std::vector<Double_t> bb_tr_vy;   //[Ndata.bb.tr.vy]
+   Int_t           Ndata_bb_tr_vz;
+   std::vector<Double_t> bb_tr_vz;   //[Ndata.bb.tr.vz]
+   Int_t           Ndata_sbs_hcal_clus_adctime;
+   std::vector<Double_t> sbs_hcal_clus_adctime;   //[Ndata.sbs.hcal.clus.adctime]
+   Int_t           Ndata_sbs_hcal_clus_e;
+   std::vector<Double_t> sbs_hcal_clus_e;   //[Ndata.sbs.hcal.clus.e]
+   Int_t           Ndata_sbs_hcal_goodblock_atime;
+   std::vector<Double_t> sbs_hcal_goodblock_atime;   //[Ndata.sbs.hcal.goodblock.atime]
+   Int_t           Ndata_sbs_hcal_goodblock_col;
+   std::vector<Double_t> sbs_hcal_goodblock_col;   //[Ndata.sbs.hcal.goodblock.col]
+   Int_t           Ndata_sbs_hcal_goodblock_e;
+   std::vector<Double_t> sbs_hcal_goodblock_e;   //[Ndata.sbs.hcal.goodblock.e]
+   Int_t           Ndata_sbs_hcal_goodblock_id;
+   std::vector<Double_t> sbs_hcal_goodblock_id;   //[Ndata.sbs.hcal.goodblock.id]
+   Int_t           Ndata_sbs_hcal_goodblock_row;
+   std::vector<Double_t> sbs_hcal_goodblock_row;   //[Ndata.sbs.hcal.goodblock.row]
+   Double_t        sbs_hcal_nclus;
+   Double_t        sbs_hcal_x;
+   Double_t        sbs_hcal_y;
+
+   // List of branches
+   TBranch        *b_Ndata_bb_hodotdc_clus_tfinal;   //!
+   TBranch        *b_bb_hodotdc_clus_tfinal;   //!
+   TBranch        *b_Ndata_bb_sh_clus_adctime;   //!
+   TBranch        *b_bb_sh_clus_adctime;   //!
+   TBranch        *b_Ndata_bb_tr_p;   //!
+   TBranch        *b_bb_tr_p;   //!
+   TBranch        *b_Ndata_bb_tr_px;   //!
+   TBranch        *b_bb_tr_px;   //!
+   TBranch        *b_Ndata_bb_tr_py;   //!
+   TBranch        *b_bb_tr_py;   //!
+   TBranch        *b_Ndata_bb_tr_pz;   //!
+   TBranch        *b_bb_tr_pz;   //!
+   TBranch        *b_Ndata_bb_tr_vx;   //!
+   TBranch        *b_bb_tr_vx;   //!
+   TBranch        *b_Ndata_bb_tr_vy;   //!
+   TBranch        *b_bb_tr_vy;   //!
+   TBranch        *b_Ndata_bb_tr_vz;   //!
+   TBranch        *b_bb_tr_vz;   //!
+   TBranch        *b_Ndata_sbs_hcal_clus_adctime;   //!
+   TBranch        *b_sbs_hcal_clus_adctime;   //!
+   TBranch        *b_Ndata_sbs_hcal_clus_e;   //!
+   TBranch        *b_sbs_hcal_clus_e;   //!
+   TBranch        *b_Ndata_sbs_hcal_goodblock_atime;   //!
+   TBranch        *b_sbs_hcal_goodblock_atime;   //!
+   TBranch        *b_Ndata_sbs_hcal_goodblock_col;   //!
+   TBranch        *b_sbs_hcal_goodblock_col;   //!
+   TBranch        *b_Ndata_sbs_hcal_goodblock_e;   //!
+   TBranch        *b_sbs_hcal_goodblock_e;   //!
+   TBranch        *b_Ndata_sbs_hcal_goodblock_id;   //!
+   TBranch        *b_sbs_hcal_goodblock_id;   //!
+   TBranch        *b_Ndata_sbs_hcal_goodblock_row;   //!
+   TBranch        *b_sbs_hcal_goodblock_row;   //!
+   TBranch        *b_sbs_hcal_nclus;   //!
+   TBranch        *b_sbs_hcal_x;   //!
+   TBranch        *b_sbs_hcal_y;   //!
+
+   SBShcal_tree(TTree *tree) : fChain(0) { Init(tree); }
+   virtual ~SBShcal_tree() { }
+   virtual Int_t    GetEntry(Long64_t entry);
+   virtual Long64_t LoadTree(Long64_t entry);
+   virtual void     Init(TTree *tree);
+   virtual Bool_t   Notify();
+   template <typename T>
+   void             BindArray(TTree *tree, const char *name, std::vector<T> &buf, TBranch **br);
+};
+
+inline Int_t SBShcal_tree::GetEntry(Long64_t entry)
+{
+   if (!fChain) return 0;
+   if (LoadTree(entry) < 0) return 0;
+   return fChain->GetEntry(entry);
+}
+
+inline Long64_t SBShcal_tree::LoadTree(Long64_t entry)
+{
+   if (!fChain) return -5;
+   Long64_t centry = fChain->LoadTree(entry);
+   if (centry < 0) return centry;
+   if (fChain->GetTreeNumber() != fCurrent) {
+      fCurrent = fChain->GetTreeNumber();
+      Notify();
+   }
+   return centry;
+}
+
+inline void SBShcal_tree::Init(TTree *tree)
+{
+   if (!tree) return;
+   fChain = tree;
+   fCurrent = -1;
+   fChain->SetMakeClass(1);
+
+   fChain->SetBranchStatus("*", 0);
+   fChain->SetBranchStatus("Ndata.bb.hodotdc.clus.tfinal", 1);
+   fChain->SetBranchStatus("bb.hodotdc.clus.tfinal", 1);
+   fChain->SetBranchStatus("Ndata.bb.sh.clus.adctime", 1);
+   fChain->SetBranchStatus("bb.sh.clus.adctime", 1);
+   fChain->SetBranchStatus("Ndata.bb.tr.p", 1);
+   fChain->SetBranchStatus("bb.tr.p", 1);
+   fChain->SetBranchStatus("Ndata.bb.tr.px", 1);
+   fChain->SetBranchStatus("bb.tr.px", 1);
+   fChain->SetBranchStatus("Ndata.bb.tr.py", 1);
+   fChain->SetBranchStatus("bb.tr.py", 1);
+   fChain->SetBranchStatus("Ndata.bb.tr.pz", 1);
+   fChain->SetBranchStatus("bb.tr.pz", 1);
+   fChain->SetBranchStatus("Ndata.bb.tr.vx", 1);
+   fChain->SetBranchStatus("bb.tr.vx", 1);
+   fChain->SetBranchStatus("Ndata.bb.tr.vy", 1);
+   fChain->SetBranchStatus("bb.tr.vy", 1);
+   fChain->SetBranchStatus("Ndata.bb.tr.vz", 1);
+   fChain->SetBranchStatus("bb.tr.vz", 1);
+   fChain->SetBranchStatus("Ndata.sbs.hcal.clus.adctime", 1);
+   fChain->SetBranchStatus("sbs.hcal.clus.adctime", 1);
+   fChain->SetBranchStatus("Ndata.sbs.hcal.clus.e", 1);
+   fChain->SetBranchStatus("sbs.hcal.clus.e", 1);
+   fChain->SetBranchStatus("Ndata.sbs.hcal.goodblock.atime", 1);
+   fChain->SetBranchStatus("sbs.hcal.goodblock.atime", 1);
+   fChain->SetBranchStatus("Ndata.sbs.hcal.goodblock.col", 1);
+   fChain->SetBranchStatus("sbs.hcal.goodblock.col", 1);
+   fChain->SetBranchStatus("Ndata.sbs.hcal.goodblock.e", 1);
+   fChain->SetBranchStatus("sbs.hcal.goodblock.e", 1);
+   fChain->SetBranchStatus("Ndata.sbs.hcal.goodblock.id", 1);
+   fChain->SetBranchStatus("sbs.hcal.goodblock.id", 1);
+   fChain->SetBranchStatus("Ndata.sbs.hcal.goodblock.row", 1);
+   fChain->SetBranchStatus("sbs.hcal.goodblock.row", 1);
+   fChain->SetBranchStatus("sbs.hcal.nclus", 1);
+   fChain->SetBranchStatus("sbs.hcal.x", 1);
+   fChain->SetBranchStatus("sbs.hcal.y", 1);
+   // used in cut strings only
+   fChain->SetBranchStatus("bb.etot_over_p", 1);
+   fChain->SetBranchStatus("Ndata.bb.etot_over_p", 1);
+   fChain->SetBranchStatus("bb.ps.e", 1);
+   fChain->SetBranchStatus("bb.sh.atimeblk", 1);
+   fChain->SetBranchStatus("bb.sh.nblk", 1);
+   fChain->SetBranchStatus("e.kine.W2", 1);
+   fChain->SetBranchStatus("sbs.hcal.atimeblk", 1);
+   fChain->SetBranchStatus("sbs.hcal.e", 1);
+   fChain->SetBranchStatus("sbs.hcal.nblk", 1);
+
+   // array buffers are bound per tree in Notify()
+   fChain->SetBranchAddress("Ndata.bb.hodotdc.clus.tfinal", &Ndata_bb_hodotdc_clus_tfinal, &b_Ndata_bb_hodotdc_clus_tfinal);
+   fChain->SetBranchAddress("Ndata.bb.sh.clus.adctime", &Ndata_bb_sh_clus_adctime, &b_Ndata_bb_sh_clus_adctime);
+   fChain->SetBranchAddress("Ndata.bb.tr.p", &Ndata_bb_tr_p, &b_Ndata_bb_tr_p);
+   fChain->SetBranchAddress("Ndata.bb.tr.px", &Ndata_bb_tr_px, &b_Ndata_bb_tr_px);
+   fChain->SetBranchAddress("Ndata.bb.tr.py", &Ndata_bb_tr_py, &b_Ndata_bb_tr_py);
+   fChain->SetBranchAddress("Ndata.bb.tr.pz", &Ndata_bb_tr_pz, &b_Ndata_bb_tr_pz);
+   fChain->SetBranchAddress("Ndata.bb.tr.vx", &Ndata_bb_tr_vx, &b_Ndata_bb_tr_vx);
+   fChain->SetBranchAddress("Ndata.bb.tr.vy", &Ndata_bb_tr_vy, &b_Ndata_bb_tr_vy);
+   fChain->SetBranchAddress("Ndata.bb.tr.vz", &Ndata_bb_tr_vz, &b_Ndata_bb_tr_vz);
+   fChain->SetBranchAddress("Ndata.sbs.hcal.clus.adctime", &Ndata_sbs_hcal_clus_adctime, &b_Ndata_sbs_hcal_clus_adctime);
+   fChain->SetBranchAddress("Ndata.sbs.hcal.clus.e", &Ndata_sbs_hcal_clus_e, &b_Ndata_sbs_hcal_clus_e);
+   fChain->SetBranchAddress("Ndata.sbs.hcal.goodblock.atime", &Ndata_sbs_hcal_goodblock_atime, &b_Ndata_sbs_hcal_goodblock_atime);
+   fChain->SetBranchAddress("Ndata.sbs.hcal.goodblock.col", &Ndata_sbs_hcal_goodblock_col, &b_Ndata_sbs_hcal_goodblock_col);
+   fChain->SetBranchAddress("Ndata.sbs.hcal.goodblock.e", &Ndata_sbs_hcal_goodblock_e, &b_Ndata_sbs_hcal_goodblock_e);
+   fChain->SetBranchAddress("Ndata.sbs.hcal.goodblock.id", &Ndata_sbs_hcal_goodblock_id, &b_Ndata_sbs_hcal_goodblock_id);
+   fChain->SetBranchAddress("Ndata.sbs.hcal.goodblock.row", &Ndata_sbs_hcal_goodblock_row, &b_Ndata_sbs_hcal_goodblock_row);
+   fChain->SetBranchAddress("sbs.hcal.nclus", &sbs_hcal_nclus, &b_sbs_hcal_nclus);
+   fChain->SetBranchAddress("sbs.hcal.x", &sbs_hcal_x, &b_sbs_hcal_x);
+   fChain->SetBranchAddress("sbs.hcal.y", &sbs_hcal_y, &b_sbs_hcal_y);
+}
+
+inline Bool_t SBShcal_tree::Notify()
+{
+   // Array buffers follow the per-tree Ndata maximum, see BindArray
+   if (!fChain || !fChain->GetTree()) return kTRUE;
+   TTree *tree = fChain->GetTree();
+   BindArray(tree, "bb.hodotdc.clus.tfinal", bb_hodotdc_clus_tfinal, &b_bb_hodotdc_clus_tfinal);
+   BindArray(tree, "bb.sh.clus.adctime", bb_sh_clus_adctime, &b_bb_sh_clus_adctime);
+   BindArray(tree, "bb.tr.p", bb_tr_p, &b_bb_tr_p);
+   BindArray(tree, "bb.tr.px", bb_tr_px, &b_bb_tr_px);
+   BindArray(tree, "bb.tr.py", bb_tr_py, &b_bb_tr_py);
+   BindArray(tree, "bb.tr.pz", bb_tr_pz, &b_bb_tr_pz);
+   BindArray(tree, "bb.tr.vx", bb_tr_vx, &b_bb_tr_vx);
+   BindArray(tree, "bb.tr.vy", bb_tr_vy, &b_bb_tr_vy);
+   BindArray(tree, "bb.tr.vz", bb_tr_vz, &b_bb_tr_vz);
+   BindArray(tree, "sbs.hcal.clus.adctime", sbs_hcal_clus_adctime, &b_sbs_hcal_clus_adctime);
+   BindArray(tree, "sbs.hcal.clus.e", sbs_hcal_clus_e, &b_sbs_hcal_clus_e);
+   BindArray(tree, "sbs.hcal.goodblock.atime", sbs_hcal_goodblock_atime, &b_sbs_hcal_goodblock_atime);
+   BindArray(tree, "sbs.hcal.goodblock.col", sbs_hcal_goodblock_col, &b_sbs_hcal_goodblock_col);
+   BindArray(tree, "sbs.hcal.goodblock.e", sbs_hcal_goodblock_e, &b_sbs_hcal_goodblock_e);
+   BindArray(tree, "sbs.hcal.goodblock.id", sbs_hcal_goodblock_id, &b_sbs_hcal_goodblock_id);
+   BindArray(tree, "sbs.hcal.goodblock.row", sbs_hcal_goodblock_row, &b_sbs_hcal_goodblock_row);
+   return kTRUE;
+}
+
+template <typename T>
+inline void SBShcal_tree::BindArray(TTree *tree, const char *name, std::vector<T> &buf, TBranch **br)
+{
+   // ROOT clamps reads to the per-tree Ndata maximum, so a buffer of
+   // LeafCapacity elements holds every entry; grown and rebound as needed
+   TBranch *branch = tree->GetBranch(name);
+   TLeaf *leaf = branch ? (TLeaf*)branch->GetListOfLeaves()->At(0) : 0;
+   if (!leaf) std::cerr << "Error >> Branch " << name << " not found in tree" << std::endl;
+   int capacity = std::max(LeafCapacity(leaf), 1);
+   if (capacity > (int)buf.size()) {
+      buf.resize(capacity);
+      fChain->SetBranchAddress(name, buf.data(), br);
+   }
+}
+
+#endif // #ifndef SBShcal_tree_h
@@ -3,25 +3,36 @@ import numpy as np
 import matplotlib.pyplot as plt
 import sys
 import pandas as pd
-from scipy.interpolate import NearestNDInterpolator
+import os
 from matplotlib.backends.backend_pdf import PdfPages
 
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "../../tools"))
+from he3_sfgrid import He3CrossSections, BuildGrid
+
 data_dirpath = "/w/halla-scshelf2102/sbs/koeneman/GEnII_analysis/outfiles/HUNTERrootfiles/"
 model_dirpath = "/w/halla-scshelf2102/sbs/koeneman/GEnII_analysis/outfiles/csvfiles/"
 model_filename = "he3model.csv"
 
-df = pd.read_csv(model_dirpath + model_filename)
+grid_filename = "he3model.sfgrid"
+
+# regular (Q2, x) grid resampled once from the csv, O(1) lookups
+if not os.path.exists(model_dirpath + grid_filename):
+    if not BuildGrid(model_dirpath + model_filename, model_dirpath + grid_filename):
+        sys.exit(f"Error >> Could not build {grid_filename} from {model_filename} (see above); "
+                 "for a CSV that is not a regular (Q2, X) grid, build it once with "
+                 "he3_sfgrid.py <csv> <grid> <nq2> <nx>")
+he3sf = He3CrossSections(model_dirpath + grid_filename)
 
-F1_QE_interpolated = NearestNDInterpolator(df[['Q2','X']], df['F1_QE'])
-F2_QE_interpolated = NearestNDInterpolator(df[['Q2','X']], df['F2_QE'])
-G1_QE_interpolated = NearestNDInterpolator(df[['Q2','X']], df['G1_QE'])
-G2_QE_interpolated = NearestNDInterpolator(df[['Q2','X']], df['G2_QE'])
+F1_QE_interpolated = he3sf.F1_QE
+F2_QE_interpolated = he3sf.F2_QE
+G1_QE_interpolated = he3sf.G1_QE
+G2_QE_interpolated = he3sf.G2_QE
 
 # Inelastic
-F1_Inelastic_interpolated = NearestNDInterpolator(df[['Q2','X']], df['F1_Inelastic'])
-F2_Inelastic_interpolated = NearestNDInterpolator(df[['Q2','X']], df['F2_Inelastic'])
-G1_Inelastic_interpolated = NearestNDInterpolator(df[['Q2','X']], df['G1_Inelastic'])
-G2_Inelastic_interpolated = NearestNDInterpolator(df[['Q2','X']], df['G2_Inelastic'])
+F1_Inelastic_interpolated = he3sf.F1_Inelastic
+F2_Inelastic_interpolated = he3sf.F2_Inelastic
+G1_Inelastic_interpolated = he3sf.G1_Inelastic
+G2_Inelastic_interpolated = he3sf.G2_Inelastic
 
 # Inelastic
 # F1_Inelastic_interpolated = NearestNDInterpolator(df[['Q2','X']], df['F1_IpQE'])
@@ -54,11 +65,7 @@ def mott_cros_sec(E, th):
     Mott Cross-section value
 
     """
-    sin_th_sqr = np.sin(th/2)**2
-    numer = alpha * np.cos(th/2) #numerator of mott cross-section inside (...)^2
-    denom = 2 * E * sin_th_sqr #denominator of mott cross-section (...)^2
-    mott = (numer/denom)**2 #value of mott cross-section
-    return mott
+    return he3sf.mott(E, th)
 
 def unpol_cros_sec(E, th, Ep, arg):
     """
@@ -73,59 +80,11 @@ def unpol_cros_sec(E, th, Ep, arg):
 
 
     """
-    mott_xsec = mott_cros_sec(E, th)
-    massn = MN
-
-    q2 = 2 * E * Ep * (1 - np.cos(th))
-    nu = E - Ep
-    x = q2 / (2 * massn * nu)
-
-    # Computing F1 and F2
-    if arg == 'QE':
-      F1 = F1_QE_interpolated(q2, x)
-      F2 = F2_QE_interpolated(q2, x)
-    elif arg == 'IN':
-      F1 = F1_Inelastic_interpolated(q2, x)
-      F2 = F2_Inelastic_interpolated(q2, x)
-    else:
-      raise ValueError("Invalid argument. Expected 'QE' or 'IN'.")
-
-    tan_th_sqr = np.tan(th/2) **2
-
-    unpol = mott_xsec * ( F2/nu + 2 * tan_th_sqr * F1 / massn ) #value of unpolarized cross-section
-
-    return unpol
+    return he3sf.unpol(E, th, Ep, arg)
 
 def pol_cros_sec(E, th, Ep, phi_star, theta_star, arg):
 
-    massn = MN
-
-    nu = E - Ep #Energy transfered from electron to Nucleon in Nucleus
-    q2 = 2 * E * Ep * (1 - np.cos(th))
-    x = q2 / (2 * massn * nu)
-    EovM = E / massn
-    tau = q2 / (4 * massn**2)
-
-    Cosbeta = (np.cos(phi_star)*np.sin(theta_star)*np.sin(th)*(EovM - 2 * tau) + np.cos(theta_star)*(EovM - (EovM - 2 * tau)*np.cos(th)))/(2*np.sqrt(tau*(1 + tau)))
-    CosTheta = (np.cos(phi_star)*np.sin(theta_star)*np.sin(th)*EovM + np.cos(theta_star)*(EovM*np.cos(th) - (EovM - 2 * tau)))/(2*np.sqrt(tau*(1 + tau)))
-
-    Gamma = -(4 * (alpha **2) * Ep) / (q2 * E * massn * nu)
-    A = E * Cosbeta + Ep * CosTheta
-    B = (2 * E * Ep / nu) * (CosTheta - Cosbeta)
-
-    # Computing g1 and g2
-    if arg == 'QE':
-      g1 = G1_QE_interpolated(q2, x)
-      g2 = G2_QE_interpolated(q2, x)
-    elif arg == 'IN':
-      g1 = G1_Inelastic_interpolated(q2, x)
-      g2 = G2_Inelastic_interpolated(q2, x)
-    else:
-      raise ValueError("Invalid argument. Expected 'QE' or 'IN'.")
-
-    pol = Gamma * (A * g1 + B * g2)
-
-    return pol
+    return he3sf.pol(E, th, Ep, phi_star, theta_star, arg)
 
 def sgn(x):
     return (x > 0) - (x < 0)
@@ -309,47 +268,13 @@ for kine in kine_list:
             etheta = np.linspace(etheta_min_rad,etheta_max_rad,numPoints)
             ephi = np.linspace(ephi_min_rad,ephi_max_rad,numPoints)
             
-            theta_star = []
-            phi_star = []
-            for i in range(numPoints):
-                ethetai = etheta[i]
-                eprimei = eprime[i]
-                ephii = ephi[i]
-                
-                ebeami = ebeam[i]
-                ke = ebeami * np.array([[0, 0, 1]])
-                keprime = eprimei * np.array([[np.cos(ephii)*np.sin(ethetai),
-                                               np.sin(ephii)*np.sin(ethetai),
-                                               np.cos(ethetai)]])
-                target_spin = np.array([[np.sin(T_magnet_angle_rad)*np.cos(T_magnet_pitch_rad),
-                                         np.sin(T_magnet_angle_rad)*np.sin(T_magnet_pitch_rad),
-                                         np.cos(T_magnet_angle_rad)]])
-                q = ke - keprime
-                
-                z_star = q / np.linalg.norm(q)
-                y_star = np.cross(ke,keprime) / (np.linalg.norm(ke) * np.linalg.norm(keprime))
-                x_star = np.cross(y_star,z_star)
-                
-                target_spin_x_star = np.dot(target_spin,x_star.T).item()
-                target_spin_y_star = np.dot(target_spin,y_star.T).item()
-                target_spin_z_star = np.dot(target_spin,z_star.T).item()
-                
-                target_spin_star = np.array([[target_spin_x_star,target_spin_y_star,target_spin_z_star]])
-                
-                theta_stari = np.arccos(target_spin_star.item(2)/np.linalg.norm(target_spin_star))
-                phi_stari = sgn(target_spin_star.item(1)) * np.arccos(target_spin_star.item(0)/np.sqrt(target_spin_star.item(0)**2 + target_spin_star.item(1)**2))
-            
-            theta_star.append(theta_stari)
-            phi_star.append(phi_stari)
+            theta_star, phi_star = he3sf.spin_angles(ebeam, etheta, eprime, ephi, T_magnet_angle_rad, T_magnet_pitch_rad)
             
             nu = ebeam - eprime
             Q2 = 2 * eprime * ebeam * (1 - np.cos(etheta))
             X = Q2 / (2 * MN * nu)
             W2 = MN**2 - Q2 + 2 * MN * nu
             
-            theta_star = np.array(theta_star)
-            phi_star = np.array(phi_star)
-            
             process = 'IN'
             xz_unpol_cross_sec = unpol_cros_sec(ebeam, etheta, eprime, process)
             xz_pol_cross_sec = pol_cros_sec(ebeam, etheta, eprime, phi_star, theta_star, process)
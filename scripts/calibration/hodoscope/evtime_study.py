@@ -1,5 +1,5 @@
-import uproot
-import awkward as ak
+import ROOT
+import os
 import numpy as np
 import matplotlib.pyplot as plt
 from scipy.optimize import curve_fit
@@ -37,31 +37,23 @@ tdiff_max = 10 # units -> ns
 
 branch_name = "g.evtime"
 
-with uproot.open(filepath) as ROOTFILE:
-
-    tree = ROOTFILE["Tout"]
-
-    Nevents = tree.num_entries
-
-    gevtime = tree[branch_name].arrays(library="np")[branch_name]
-
-sorted_gevtime = np.sort(gevtime)
-dgevtime = np.diff(sorted_gevtime)
-dgevtime = dgevtime[dgevtime > 0]
-
-candidates = np.linspace(1.0, 20.0, 190001)
+# --- Clock period (compiled, see evtime_clock.C) --- #
+# Same score as before, min(dt mod T, T - dt mod T) < tol over the sorted
+# positive g.evtime differences for T in [1, 20] ns in steps of 1e-4 ns,
+# searched coarse to fine on all cores. One line per input file, or per run
+# with run_branch set.
+candidates_min, candidates_max, candidates_step = 1.0, 20.0, 1e-4
 tol = 0.1
+txtout = f"./outfiles/evtime_clock_{kin_pass}_{kin}.txt"
 
-def score(T):
-    r = np.mod(dgevtime, T)
-    r = np.minimum(r, T - r)
-    return np.mean(r < tol)
-
-scores = np.array([score(T) for T in candidates])
-T_hat = candidates[np.argmax(scores)]
+macro = os.path.join(os.path.dirname(os.path.abspath(__file__)), "evtime_clock.C")
+ROOT.gROOT.LoadMacro(macro + "+")
+ROOT.evtime_clock(filepath, txtout, "", candidates_min, candidates_max, candidates_step, tol, 0, "Tout", branch_name)
 
-print("Estimated clock period (ns):", T_hat)
+run, T_hat, T_score, phase, phase_rms, nevents = np.loadtxt(txtout, skiprows=1, unpack=True, ndmin=2)
 
+for r, T, s, ph in zip(run, T_hat, T_score, phase):
+    print(f"{int(r)}: estimated clock period (ns): {T:.5f}, score {s:.4f}, trigger phase (ns): {ph:.4f}")
 
 # plt.hist(g_q, bins=int(np.sqrt(Nevents)), range=(-0.5,5))
 # plt.xlabel("g.evtime[i] - g.evtime[j]")
@@ -1,13 +1,19 @@
 import ROOT
 import numpy as np
+import uproot
 import matplotlib.pyplot as plt
 from matplotlib.backends.backend_pdf import PdfPages
 import os 
+import sys
+
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), "../../tools"))
+from array_kernels import firsts, hodo_vscint, hodo_vscint_fit
 
 def VscintCalibration(filepath: str,
                       nbars: int,
                       ToTcalibration: str ="default_hodo_ToT_calibration.txt",
-                      internaloffset: str ="default_hodo_internal_alignment_calibration.txt"
+                      internaloffset: str ="default_hodo_internal_alignment_calibration.txt",
+                      step_size: str ="500 MB"
                       ):
 
     ### Constants ###
@@ -24,29 +30,15 @@ def VscintCalibration(filepath: str,
 
     etof0 = (BBdist + 3.0)/speed_of_light
 
-    ### Forming Chain ###
-    chain = ROOT.TChain("Tout")
-    chain.Add(filepath)
-    print(f"Initialized TChain: {filepath} with TTree = Tout")
-
-    ### Creating TTreeReader ###
-    reader = ROOT.TTreeReader(chain)
-
-    ### Variables needed for Calibration ###
-    nhits = ROOT.TTreeReaderValue["int"](reader, "Ndata.bb.hodotdc.clus.bar.tdc.id")
-    yfp = ROOT.TTreeReaderArray("double")(reader, "bb.tr.y")
-    xfp = ROOT.TTreeReaderArray("double")(reader, "bb.tr.x")
-    thfp = ROOT.TTreeReaderArray("double")(reader, "bb.tr.th")
-    phfp = ROOT.TTreeReaderArray("double")(reader, "bb.tr.ph")
-    barid = ROOT.TTreeReaderArray["double"](reader, "bb.hodotdc.clus.bar.tdc.id")
-    tleft = ROOT.TTreeReaderArray["double"](reader, "bb.hodotdc.clus.bar.tdc.tleft")
-    tright = ROOT.TTreeReaderArray["double"](reader, "bb.hodotdc.clus.bar.tdc.tright")
-    trigtime = ROOT.TTreeReaderValue["double"](reader, "bb.hodotdc.trigtime")
-    totleft = ROOT.TTreeReaderArray["double"](reader, "bb.hodotdc.clus.bar.tdc.totleft")
-    totright = ROOT.TTreeReaderArray["double"](reader, "bb.hodotdc.clus.bar.tdc.totright")
-    etof = ROOT.TTreeReaderArray("double")(reader, "bb.hodotdc.clus.bar.tdc.etof")
-    runnum = ROOT.TTreeReaderValue["double"](reader, "g.runnum")
-    gevtime = ROOT.TTreeReaderValue["double"](reader, "g.evtime")
+    ### Branches needed for Calibration ###
+    track_branches = ["bb.tr.x", "bb.tr.y", "bb.tr.th", "bb.tr.ph"]
+    bar_branches = ["bb.hodotdc.clus.bar.tdc.id",
+                    "bb.hodotdc.clus.bar.tdc.tleft",
+                    "bb.hodotdc.clus.bar.tdc.tright",
+                    "bb.hodotdc.clus.bar.tdc.totleft",
+                    "bb.hodotdc.clus.bar.tdc.totright",
+                    "bb.hodotdc.clus.bar.tdc.etof"]
+    event_branches = ["bb.hodotdc.trigtime", "g.evtime"]
 
     sumreftime = 0
     sumN = 0
@@ -85,13 +77,6 @@ def VscintCalibration(filepath: str,
         dtype=float
     )
 
-    # vscint = np.zeros(nbars)
-    sum_d_times_t = np.zeros(nbars)
-    sum_d_sqr = np.zeros(nbars)
-    sum_t = np.zeros(nbars)
-    sum_d = np.zeros(nbars)
-    counts = np.zeros(nbars)
-
     ### Forming histograms ###
     hist2d_list = []
     hodoymin, hodoymax = -hodo_bar_width/2 , hodo_bar_width/2
@@ -112,86 +97,35 @@ def VscintCalibration(filepath: str,
         hist2d_list.append(hist2d)
     
     ### The event loop ###
+    # read in chunks as awkward arrays, looped over in C++ (array_kernels.py)
     print("Starting Event Loop ...")
-    Nevents = chain.GetEntries()
-    print(f"total events = {Nevents}")
-    ievent = 0
-    while reader.Next():
-
-        ievent += 1
-
-        trig = trigtime.Get()[0]
-        evt = int(gevtime.Get()[0])
-
-        y = yfp[0] + z_hodo * phfp[0]
-        x = xfp[0] + z_hodo * thfp[0]
-        
-        dleft = min(hodo_bar_width, max(0.0, hodo_bar_width/2.0 - y))
-        dright = min(hodo_bar_width, max(0.0, hodo_bar_width/2.0 + y))
+    sums = np.zeros((nbars, 5))
+    nevents = 0
+    for arrays in uproot.iterate(f"{filepath}:Tout",
+                                 track_branches + bar_branches + event_branches,
+                                 step_size=step_size,
+                                 library="ak"):
+        xfp, yfp, thfp, phfp = [firsts(arrays[b]) for b in track_branches]
+        barid, tleft, tright, totleft, totright, etof = [arrays[b] for b in bar_branches]
+        trigtime, gevtime = [firsts(arrays[b]) if arrays[b].ndim > 1 else arrays[b] for b in event_branches]
+
+        sums, hit_bar, hit_d, hit_tdiff = hodo_vscint(trigtime, gevtime, xfp, yfp, thfp, phfp,
+                                                      barid, tleft, tright, totleft, totright, etof,
+                                                      nbars, offset, wleft, wright,
+                                                      sums=sums, hits=True)
+        for bar in np.unique(hit_bar):
+            selected = hit_bar == bar
+            hist2d_list[bar].FillN(int(selected.sum()),
+                                   np.ascontiguousarray(hit_d[selected]),
+                                   np.ascontiguousarray(hit_tdiff[selected]),
+                                   ROOT.nullptr)
+        nevents += len(trigtime)
+        print(f"Events processed: {nevents}")
 
-        if (trig<400):
-            
-            tref = trig - 4.0 * (6 % (2 + 6 % (evt))) - TBBtrig_t0
-
-            for i in range(nhits.Get()[0]):
-
-                barid_i = int(barid[i])
-                barx = 0.5 * hodscope_height - hodo_bar_height * (0.5 + barid_i)
-                diffx = x - barx
-                
-                if ((totleft[i]>0.0) &
-                    (totright[i]>0.0) &
-                    (abs(dleft - dright)<0.3) &
-                    (abs(diffx)<0.5*hodo_bar_height)
-                    ):
-
-                    tleft_corr = tleft[i] + tref - wleft[barid_i] * totleft[i] - offset[barid_i] - (etof[i] - etof0)
-                    tright_corr = tright[i] + tref - wright[barid_i] * totright[i] - offset[barid_i] - (etof[i] - etof0)
-                    
-                    sum_d_times_t[barid_i] += (dleft - dright) * (tleft_corr - tright_corr)
-                    sum_d_sqr[barid_i] += (dleft - dright)**2
-                    sum_t[barid_i] += (tleft_corr - tright_corr)
-                    sum_d[barid_i] += (dleft - dright)
-                    counts[barid_i] += 1.0
-
-                    hist2d_list[barid_i].Fill(dleft-dright,tleft_corr-tright_corr)
-                    
-        if ievent%100000 == 0:
-            print(f"Percent complete: {ievent/Nevents*100.0:.2f}%")
-
-    print("Percent complete: 100.00%")
     print("Event Loop Finished!")
-    
-    inv_vscint = []
-    tdiff_offset = []
-    for i in range(nbars):
-        if (counts[i]>0):
-            
-            avg_t = sum_t[i] / counts[i]
-            avg_d = sum_d[i] / counts[i]
-            avg_d_times_t = sum_d_times_t[i] / counts[i]
-            avg_d_sqr = sum_d_sqr[i] / counts[i]
-
-            if (avg_d_sqr - (avg_d)**2) != 0.0:
-                inv_vscinti = (avg_d_times_t - avg_t * avg_d) / (avg_d_sqr - (avg_d)**2)
-                someintercept = avg_t - inv_vscinti * avg_d
-
-                if inv_vscinti < 0.0:
-                    inv_vscinti = 1.0/0.16
-            else :
-                someintercept = 0.0
-                inv_vscinti = 1.0/0.16
-
-        else:
-            inv_vscinti = 1.0/0.16
-            someintercept = 0.0
-
-        inv_vscint.append(inv_vscinti)
-        tdiff_offset.append(someintercept)
-    
-    inv_vscint = np.array(inv_vscint)
-    tdiff_offset = np.array(tdiff_offset)
-    vscint = 1 / inv_vscint
+
+    vscint, tdiff_offset = hodo_vscint_fit(sums)
+    inv_vscint = 1 / vscint
 
     ### Plotting vscint for each bar ###
     pdf_filename = "./figures/plots_hodo_vscint_calibration.pdf"
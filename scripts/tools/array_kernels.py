@@ -0,0 +1,171 @@
+import os
+
+import numpy as np
+import ROOT
+
+#########################################
+#########################################
+##
+##  Purpose: Thin python binding of the
+##  compiled array kernels
+##  (include/arrayKernels.C): HCal
+##  dx/dy, W2, Q2, cluster times and the
+##  hodoscope vscint sums computed in C++
+##  straight from numpy / awkward buffers.
+##
+##  float64 numpy arrays and the content
+##  and offsets of awkward lists are
+##  handed over as pointers (no copy),
+##  results come back as numpy arrays and
+##  the kernels run with the GIL released,
+##  so python threads can split the events.
+##
+##  Usage:
+##    from array_kernels import hcal_kinematics, cluster_time, hodo_vscint
+##    dx, dy, W2, Q2 = hcal_kinematics(ebeam, hcal_angle, hcal_distance,
+##                                     px, py, pz, vx, vy, vz, hcalx, hcaly)
+##    mean, rms = cluster_time(blk_e, blk_atime, sh_e)   # awkward lists
+##
+#########################################
+#########################################
+
+include_path = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                            "../../include/arrayKernels.C")
+ROOT.gInterpreter.Declare('#include "%s"' % include_path)
+
+Mp = 0.938272088 # PDG 2025
+Mn = 0.939565420 # PDG 2025
+
+# offsets are passed as numpy int64 (C++ long)
+_kinematics = ROOT.HCalKinematicsArrays
+_cluster_time = ROOT.ClusterTimeArrays["long"]
+_hodo_vscint = ROOT.HodoVscintArrays["long"]
+_hodo_vscint_fit = ROOT.HodoVscintFit
+for _kernel in (_kinematics, _cluster_time, _hodo_vscint, _hodo_vscint_fit):
+    _kernel.__release_gil__ = True
+
+def flat(array):
+    """
+    Contiguous float64 view of array; copies only when the dtype or the
+    strides differ.
+    """
+    return np.ascontiguousarray(array, dtype=np.float64)
+
+def jagged(array):
+    """
+    (content, offsets) of a list per event: an awkward array of numbers or
+    a (content, offsets) pair, offsets of length nevents + 1. The content of
+    a packed float64 awkward array is used in place.
+    """
+    if isinstance(array, tuple):
+        content, offsets = array
+    else:
+        import awkward as ak
+        layout = ak.to_layout(array)
+        if not isinstance(layout, ak.contents.ListOffsetArray):
+            layout = ak.to_layout(ak.to_packed(array))
+        content, offsets = layout.content, layout.offsets
+    content = flat(content)
+    offsets = np.ascontiguousarray(offsets, dtype=np.int64)
+    if (offsets.ndim != 1 or offsets.size < 1 or offsets[0] < 0
+            or offsets[-1] > content.size or np.any(np.diff(offsets) < 0)):
+        raise ValueError("Offsets do not index the list content")
+    return content, offsets
+
+def same_size(n, **arrays):
+    """
+    Raises ValueError unless every array has n entries: the kernels get raw
+    pointers and would read or write past the end of a shorter one.
+    """
+    for name, a in arrays.items():
+        if a.size != n:
+            raise ValueError("%s has %d entries, expected %d" % (name, a.size, n))
+
+def firsts(array, fill=np.nan):
+    """
+    First element of every event of an awkward list (bb.tr.x[0], ...),
+    fill for empty events.
+    """
+    import awkward as ak
+    return flat(ak.to_numpy(ak.fill_none(ak.firsts(array), fill)))
+
+def hcal_kinematics(ebeam, hcal_angle, hcal_distance, px, py, pz, vx, vy, vz, hcalx, hcaly,
+                    MN=0.5*(Mp + Mn)):
+    """
+    dx, dy (computeDxDy, hcal_angle in degrees), W2 and Q2 of every event
+    from the electron track momentum and vertex.
+    """
+    px, py, pz, vx, vy, vz, hcalx, hcaly = [flat(a) for a in (px, py, pz, vx, vy, vz, hcalx, hcaly)]
+    n = px.size
+    same_size(n, py=py, pz=pz, vx=vx, vy=vy, vz=vz, hcalx=hcalx, hcaly=hcaly)
+    dx, dy, W2, Q2 = [np.empty(n) for _ in range(4)]
+    _kinematics(ebeam, hcal_angle, hcal_distance, MN, px, py, pz, vx, vy, vz, hcalx, hcaly, n,
+                dx, dy, W2, Q2)
+    return dx, dy, W2, Q2
+
+def cluster_time(e, t, eclus, frac=0.1):
+    """
+    Energy weighted cluster time (clusterTime.C) and its rms per event from
+    the block energies and times (lists) and the cluster energy.
+    """
+    e, offsets = jagged(e)
+    t, t_offsets = jagged(t)
+    if not np.array_equal(offsets, t_offsets):
+        raise ValueError("Block energies and times have different lengths")
+    eclus = flat(eclus)
+    nevents = offsets.size - 1
+    same_size(nevents, eclus=eclus)
+    mean, rms = np.empty(nevents), np.empty(nevents)
+    _cluster_time(e, t, offsets, eclus, nevents, frac, mean, rms)
+    return mean, rms
+
+def hodo_vscint(trigtime, evtime, xfp, yfp, thfp, phfp,
+                barid, tleft, tright, totleft, totright, etof,
+                nbars, offset, wleft, wright, sums=None, hits=False):
+    """
+    hodo_vscint_calibration.py event loop. Track variables are per event
+    (firsts() of bb.tr.*), the bar variables are lists. Returns the (nbars, 5)
+    sums n, x, y, xx, xy of tL - tR against dL - dR, added to sums when given
+    so files or chunks accumulate; with hits=True also the bar id, dL - dR and
+    tL - tR of every hit used.
+    """
+    barid, offsets = jagged(barid)
+    bars = []
+    for name, a in (("tleft", tleft), ("tright", tright), ("totleft", totleft),
+                    ("totright", totright), ("etof", etof)):
+        content, a_offsets = jagged(a)
+        if not np.array_equal(offsets, a_offsets):
+            raise ValueError("Bar ids and %s have different offsets" % name)
+        bars.append(content)
+    tleft, tright, totleft, totright, etof = bars
+    trigtime, evtime, xfp, yfp, thfp, phfp = [flat(a) for a in (trigtime, evtime, xfp, yfp, thfp, phfp)]
+    same_size(offsets.size - 1, trigtime=trigtime, evtime=evtime, xfp=xfp, yfp=yfp,
+              thfp=thfp, phfp=phfp)
+    offset, wleft, wright = [flat(a) for a in (offset, wleft, wright)]
+    same_size(nbars, offset=offset, wleft=wleft, wright=wright)
+    if sums is None:
+        sums = np.zeros((nbars, 5))
+    elif (not isinstance(sums, np.ndarray) or sums.shape != (nbars, 5)
+          or sums.dtype != np.float64 or not sums.flags.c_contiguous):
+        raise ValueError("sums must be a contiguous float64 (nbars, 5) array")
+    hit_d = np.full(barid.size, np.nan) if hits else ROOT.nullptr
+    hit_tdiff = np.full(barid.size, np.nan) if hits else ROOT.nullptr
+    _hodo_vscint(trigtime, evtime, xfp, yfp, thfp, phfp, offsets, offsets.size - 1,
+                 barid, tleft, tright, totleft, totright, etof,
+                 nbars, offset, wleft, wright, sums.reshape(-1), hit_d, hit_tdiff)
+    if not hits:
+        return sums
+    used = ~np.isnan(hit_d)
+    return sums, barid[used].astype(int), hit_d[used], hit_tdiff[used]
+
+def hodo_vscint_fit(sums):
+    """
+    vscint (m/ns) and tdiff offset per bar from the hodo_vscint sums.
+    """
+    sums = flat(sums)
+    if sums.size % 5 != 0:
+        raise ValueError("sums must be an (nbars, 5) array")
+    nbars = sums.size // 5
+    vscint, tdiff_offset = np.empty(nbars), np.empty(nbars)
+    _hodo_vscint_fit(sums, nbars, vscint, tdiff_offset)
+    return vscint, tdiff_offset
@@ -0,0 +1,136 @@
+import os
+import sys
+
+import numpy as np
+import ROOT
+
+#########################################
+#########################################
+##
+##  Purpose: Thin python binding of the
+##  compiled He3 structure-function grid
+##  (include/structureFunctionGrid.C), a
+##  drop-in for the eight scipy
+##  NearestNDInterpolator objects of the
+##  Asymmetry_*.py scripts, and of the
+##  cross sections built on it
+##  (include/crossSection.C), a drop-in for
+##  mott_cros_sec, unpol_cros_sec,
+##  pol_cros_sec and the theta_star/phi_star
+##  loop.
+##
+##  Usage:
+##    python he3_sfgrid.py he3model.csv he3model.sfgrid   (build once)
+##
+##    from he3_sfgrid import He3StructureFunctions
+##    sf = He3StructureFunctions("he3model.sfgrid")
+##    F1 = sf.F1_QE(Q2, X)        # scalars or numpy arrays
+##
+##    from he3_sfgrid import He3CrossSections
+##    xs = He3CrossSections("he3model.sfgrid")
+##    theta_star, phi_star = xs.spin_angles(E, th, Ep, ph, T_magnet_angle_rad, T_magnet_pitch_rad)
+##    unpol = xs.unpol(E, th, Ep, 'IN')
+##
+#########################################
+#########################################
+
+include_path = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                            "../../include/crossSection.C")
+ROOT.gInterpreter.Declare('#include "%s"' % include_path)
+
+functions = ["F1_QE", "F2_QE", "G1_QE", "G2_QE",
+             "F1_Inelastic", "F2_Inelastic", "G1_Inelastic", "G2_Inelastic"]
+
+processes = {"QE": ROOT.kXS_QE, "IN": ROOT.kXS_IN}
+
+def BuildGrid(csvpath, gridpath, nq2=0, nx=0):
+    """
+    Writes the model CSV as a grid file (see BuildSFGrid). nq2 = nx = 0
+    needs a CSV that is itself a regular (Q2, X) grid; otherwise give the
+    grid size to resample it on the nearest points.
+    """
+    return bool(ROOT.BuildSFGrid(csvpath, gridpath, nq2, nx))
+
+class He3StructureFunctions:
+    """
+    One attribute per structure function, each callable as f(Q2, X) with
+    the NearestNDInterpolator call signature.
+    """
+    def __init__(self, gridpath):
+        self.grid = ROOT.SFGrid_t()
+        if not self.grid.Open(gridpath):
+            raise IOError(f"Could not open structure function grid {gridpath}")
+        for index, name in enumerate(functions):
+            setattr(self, name, self._Evaluator(index))
+
+    def _Evaluator(self, index):
+        def evaluate(q2, x):
+            q2 = np.asarray(q2, dtype=np.float64)
+            x = np.asarray(x, dtype=np.float64)
+            q2, x = np.broadcast_arrays(q2, x)
+            q2 = np.ascontiguousarray(q2)
+            x = np.ascontiguousarray(x)
+            out = np.empty(q2.shape, dtype=np.float64)
+            self.grid.EvalArray(index, q2, x, out, out.size)
+            return out if out.ndim else float(out)
+        return evaluate
+
+def _arrays(*args):
+    arrays = np.broadcast_arrays(*[np.asarray(a, dtype=np.float64) for a in args])
+    return [np.ascontiguousarray(a) for a in arrays]
+
+def _process(arg):
+    if arg not in processes:
+        raise ValueError("Invalid argument. Expected 'QE' or 'IN'.")
+    return processes[arg]
+
+class He3CrossSections(He3StructureFunctions):
+    """
+    He3StructureFunctions plus the cross sections built on them. Every
+    method takes scalars or numpy arrays and broadcasts them.
+    """
+    def spin_angles(self, E, th, Ep, ph, spin_angle, spin_pitch):
+        E, th, Ep, ph = _arrays(E, th, Ep, ph)
+        theta_star = np.empty(E.shape)
+        phi_star = np.empty(E.shape)
+        ROOT.TargetSpinAnglesArray(E, th, Ep, ph, E.size, spin_angle, spin_pitch, theta_star, phi_star)
+        return theta_star, phi_star
+
+    def mott(self, E, th):
+        E, th = _arrays(E, th)
+        out = np.empty(E.shape)
+        ROOT.CrossSectionArrays(self.grid, ROOT.kXS_QE, E, th, E, th, th, E.size,
+                                out, ROOT.nullptr, ROOT.nullptr)
+        return out
+
+    def unpol(self, E, th, Ep, arg):
+        E, th, Ep = _arrays(E, th, Ep)
+        out = np.empty(E.shape)
+        ROOT.CrossSectionArrays(self.grid, _process(arg), E, th, Ep, th, th, E.size,
+                                ROOT.nullptr, out, ROOT.nullptr)
+        return out
+
+    def pol(self, E, th, Ep, phi_star, theta_star, arg):
+        E, th, Ep, phi_star, theta_star = _arrays(E, th, Ep, phi_star, theta_star)
+        out = np.empty(E.shape)
+        ROOT.CrossSectionArrays(self.grid, _process(arg), E, th, Ep, phi_star, theta_star, E.size,
+                                ROOT.nullptr, ROOT.nullptr, out)
+        return out
+
+    def asymmetry(self, E, th, Ep, ph, spin_angle, spin_pitch, arg):
+        """
+        pol / (2 unpol), 0 where unpol vanishes.
+        """
+        E, th, Ep, ph = _arrays(E, th, Ep, ph)
+        out = np.empty(E.shape)
+        ROOT.ModelAsymmetryArray(self.grid, _process(arg), E, th, Ep, ph, E.size,
+                                 spin_angle, spin_pitch, out)
+        return out
+
+if __name__ == "__main__":
+    if len(sys.argv) < 3:
+        print("Usage: python he3_sfgrid.py <he3model.csv> <output.sfgrid> [nq2] [nx]")
+        sys.exit(1)
+    nq2 = int(sys.argv[3]) if len(sys.argv) > 3 else 0
+    nx = int(sys.argv[4]) if len(sys.argv) > 4 else 0
+    sys.exit(0 if BuildGrid(sys.argv[1], sys.argv[2], nq2, nx) else 1)
@@ -0,0 +1,272 @@
+import argparse
+import os
+import re
+import sys
+from datetime import date
+
+#########################################
+#########################################
+##
+##  Purpose: Generate a minimal MakeClass
+##  style reader for a macro. The macro is
+##  scanned for T->member uses and only the
+##  matching branches of the full MakeClass
+##  dump (gen_tree.h) are declared, bound
+##  and enabled. Branch names quoted in the
+##  macro (TCut / TTreeFormula strings) are
+##  enabled without being bound. Variable
+##  length arrays are std::vector buffers
+##  sized per tree from the Ndata maximum
+##  (LeafCapacity, include/arrayBuffer.C),
+##  so no file is too large for the reader.
+##
+##  Usage:
+##    python make_reader.py ../QA/Cointime.C
+##    python make_reader.py ../QA/SBShcal.C --object T \
+##        --header ../analysis/old_code/gen_tree.h
+##
+#########################################
+#########################################
+
+default_header = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                              "../analysis/old_code/gen_tree.h")
+array_buffer = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                            "../../include/arrayBuffer.C")
+
+decl_re = re.compile(r"^\s+(\w+)\s+(\w+)(\[\d+\])?;\s*(?://\[(.*)\])?")
+addr_re = re.compile(r'fChain->SetBranchAddress\("([^"]+)",\s*&?(\w+),\s*&(\w+)\);')
+string_re = re.compile(r'"((?:[^"\\]|\\.)*)"')
+token_re = re.compile(r"[A-Za-z_][\w.]*")
+
+def ParseMakeClass(header):
+    """
+    Returns the ordered list of members of the MakeClass dump. Each entry
+    holds the leaf type, array dimension, counter branch, branch name and
+    branch pointer name.
+    """
+    members = {}
+    order = []
+    with open(header) as f:
+        lines = f.readlines()
+
+    in_decl = False
+    for line in lines:
+        if "Declaration of leaf types" in line:
+            in_decl = True
+            continue
+        if "List of branches" in line:
+            in_decl = False
+            continue
+        if in_decl:
+            m = decl_re.match(line)
+            if m:
+                members[m.group(2)] = {"type": m.group(1),
+                                       "dim": m.group(3) or "",
+                                       "counter": m.group(4)}
+                order.append(m.group(2))
+            continue
+        m = addr_re.search(line)
+        if m and m.group(2) in members:
+            members[m.group(2)]["branch"] = m.group(1)
+            members[m.group(2)]["pointer"] = m.group(3)
+
+    return [(name, members[name]) for name in order if "branch" in members[name]]
+
+def ScanMacro(macro, obj):
+    with open(macro) as f:
+        text = f.read()
+    # drop comments so commented-out code does not pull in branches
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"//[^\n]*", "", text)
+    used = set(re.findall(r"\b" + re.escape(obj) + r"->(\w+)", text))
+    quoted = set()
+    for s in string_re.findall(text):
+        quoted.update(token_re.findall(s))
+    return used, quoted
+
+def IsVector(m):
+    """
+    Variable length arrays (with an Ndata counter) get a std::vector buffer.
+    """
+    return bool(m["dim"] and m["counter"])
+
+def WriteReader(path, classname, macro, header, bound, enabled):
+    guard = classname + "_h"
+    vectors = [(name, m) for name, m in bound if IsVector(m)]
+    include = os.path.relpath(os.path.abspath(array_buffer), os.path.dirname(os.path.abspath(path)))
+    out = []
+    out.append("//////////////////////////////////////////////////////////")
+    out.append("// Minimal reader generated on %s by scripts/tools/make_reader.py" % date.today())
+    out.append("// from %s" % os.path.basename(header))
+    out.append("// for %s" % os.path.basename(macro))
+    out.append("// Only the branches used by the macro are enabled and bound.")
+    out.append("// Regenerate instead of editing by hand.")
+    out.append("//////////////////////////////////////////////////////////")
+    out.append("")
+    out.append("#ifndef %s" % guard)
+    out.append("#define %s" % guard)
+    out.append("")
+    out.append("#include <TROOT.h>")
+    out.append("#include <TChain.h>")
+    out.append("#include <TFile.h>")
+    out.append("#include <TLeaf.h>")
+    out.append("#include \"%s\"" % include.replace(os.sep, "/"))
+    out.append("")
+    out.append("#include <algorithm>")
+    out.append("#include <iostream>")
+    out.append("#include <vector>")
+    out.append("")
+    out.append("class %s {" % classname)
+    out.append("public :")
+    out.append("   TTree          *fChain;   //!pointer to the analyzed TTree or TChain")
+    out.append("   Int_t           fCurrent; //!current Tree number in a TChain")
+    out.append("")
+    out.append("   // Declaration of leaf types")
+    for name, m in bound:
+        if IsVector(m):
+            decl = "   %-15s %s;" % ("std::vector<%s>" % m["type"], name)
+        else:
+            decl = "   %-15s %s%s;" % (m["type"], name, m["dim"])
+        out.append(decl + ("   //[%s]" % m["counter"] if m["counter"] else ""))
+    out.append("")
+    out.append("   // List of branches")
+    for name, m in bound:
+        out.append("   TBranch        *%s;   //!" % m["pointer"])
+    out.append("")
+    out.append("   %s(TTree *tree) : fChain(0) { Init(tree); }" % classname)
+    out.append("   virtual ~%s() { }" % classname)
+    out.append("   virtual Int_t    GetEntry(Long64_t entry);")
+    out.append("   virtual Long64_t LoadTree(Long64_t entry);")
+    out.append("   virtual void     Init(TTree *tree);")
+    out.append("   virtual Bool_t   Notify();")
+    if vectors:
+        out.append("   template <typename T>")
+        out.append("   void             BindArray(TTree *tree, const char *name, std::vector<T> &buf, TBranch **br);")
+    out.append("};")
+    out.append("")
+    out.append("inline Int_t %s::GetEntry(Long64_t entry)" % classname)
+    out.append("{")
+    out.append("   if (!fChain) return 0;")
+    out.append("   if (LoadTree(entry) < 0) return 0;")
+    out.append("   return fChain->GetEntry(entry);")
+    out.append("}")
+    out.append("")
+    out.append("inline Long64_t %s::LoadTree(Long64_t entry)" % classname)
+    out.append("{")
+    out.append("   if (!fChain) return -5;")
+    out.append("   Long64_t centry = fChain->LoadTree(entry);")
+    out.append("   if (centry < 0) return centry;")
+    out.append("   if (fChain->GetTreeNumber() != fCurrent) {")
+    out.append("      fCurrent = fChain->GetTreeNumber();")
+    out.append("      Notify();")
+    out.append("   }")
+    out.append("   return centry;")
+    out.append("}")
+    out.append("")
+    out.append("inline void %s::Init(TTree *tree)" % classname)
+    out.append("{")
+    out.append("   if (!tree) return;")
+    out.append("   fChain = tree;")
+    out.append("   fCurrent = -1;")
+    out.append("   fChain->SetMakeClass(1);")
+    out.append("")
+    out.append("   fChain->SetBranchStatus(\"*\", 0);")
+    for name, m in bound:
+        out.append("   fChain->SetBranchStatus(\"%s\", 1);" % m["branch"])
+    if enabled:
+        out.append("   // used in cut strings only")
+        for branch in enabled:
+            out.append("   fChain->SetBranchStatus(\"%s\", 1);" % branch)
+    out.append("")
+    if vectors:
+        out.append("   // array buffers are bound per tree in Notify()")
+    for name, m in bound:
+        if IsVector(m):
+            continue
+        amp = "" if m["dim"] else "&"
+        out.append("   fChain->SetBranchAddress(\"%s\", %s%s, &%s);" %
+                   (m["branch"], amp, name, m["pointer"]))
+    out.append("}")
+    out.append("")
+    out.append("inline Bool_t %s::Notify()" % classname)
+    out.append("{")
+    if vectors:
+        out.append("   // Array buffers follow the per-tree Ndata maximum, see BindArray")
+        out.append("   if (!fChain || !fChain->GetTree()) return kTRUE;")
+        out.append("   TTree *tree = fChain->GetTree();")
+        for name, m in vectors:
+            out.append("   BindArray(tree, \"%s\", %s, &%s);" % (m["branch"], name, m["pointer"]))
+    out.append("   return kTRUE;")
+    out.append("}")
+    out.append("")
+    if vectors:
+        out.append("template <typename T>")
+        out.append("inline void %s::BindArray(TTree *tree, const char *name, std::vector<T> &buf, TBranch **br)" % classname)
+        out.append("{")
+        out.append("   // ROOT clamps reads to the per-tree Ndata maximum, so a buffer of")
+        out.append("   // LeafCapacity elements holds every entry; grown and rebound as needed")
+        out.append("   TBranch *branch = tree->GetBranch(name);")
+        out.append("   TLeaf *leaf = branch ? (TLeaf*)branch->GetListOfLeaves()->At(0) : 0;")
+        out.append("   if (!leaf) std::cerr << \"Error >> Branch \" << name << \" not found in tree\" << std::endl;")
+        out.append("   int capacity = std::max(LeafCapacity(leaf), 1);")
+        out.append("   if (capacity > (int)buf.size()) {")
+        out.append("      buf.resize(capacity);")
+        out.append("      fChain->SetBranchAddress(name, buf.data(), br);")
+        out.append("   }")
+        out.append("}")
+        out.append("")
+    out.append("#endif // #ifndef %s" % guard)
+    out.append("")
+
+    with open(path, "w") as f:
+        f.write("\n".join(out))
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate a used-branch reader from a MakeClass dump")
+    parser.add_argument("macro", help="macro to scan for <object>->member uses")
+    parser.add_argument("--object", default="T", help="name of the reader object in the macro")
+    parser.add_argument("--header", default=default_header, help="full MakeClass header")
+    parser.add_argument("--name", default=None, help="class name (default <macro>_tree)")
+    parser.add_argument("--outdir", default=None, help="output directory (default: next to the macro)")
+    args = parser.parse_args()
+
+    members = ParseMakeClass(args.header)
+    by_name = dict(members)
+    by_branch = {m["branch"]: name for name, m in members}
+
+    used, quoted = ScanMacro(args.macro, args.object)
+
+    unknown = sorted(u for u in used if u not in by_name)
+    for u in unknown:
+        if u not in ("GetEntry", "LoadTree", "Init", "Notify", "fChain", "fCurrent"):
+            print("Warning >> %s->%s is not a branch of %s" % (args.object, u, args.header))
+
+    wanted = set(u for u in used if u in by_name)
+    # variable length arrays need their Ndata counter read as well
+    for name in list(wanted):
+        counter = by_name[name]["counter"]
+        if counter and counter in by_branch:
+            wanted.add(by_branch[counter])
+
+    bound = [(name, m) for name, m in members if name in wanted]
+    bound_branches = set(m["branch"] for name, m in bound)
+    enabled = []
+    for name, m in members:
+        if m["branch"] in quoted and m["branch"] not in bound_branches:
+            enabled.append(m["branch"])
+            counter = m["counter"]
+            if counter and counter in by_branch and counter not in bound_branches and counter not in enabled:
+                enabled.append(counter)
+
+    base = os.path.splitext(os.path.basename(args.macro))[0]
+    classname = args.name or base + "_tree"
+    outdir = args.outdir or os.path.dirname(os.path.abspath(args.macro))
+    path = os.path.join(outdir, classname + ".h")
+    WriteReader(path, classname, args.macro, args.header, bound, enabled)
+
+    print("%s: %d of %d branches bound, %d enabled for cuts -> %s" %
+          (classname, len(bound), len(members), len(enabled), path))
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())